@@ -0,0 +1,51 @@
+//
+// benchmark_board.cpp
+// Benchmark C++ code
+// ----------------------------------
+//
+// Details Micro-benchmark of the board send functions, JSON report
+// Project Pervasive Displays Library Suite
+// Based on highView technology
+//
+// Created by Rei Vilo, 17 Oct 2026
+//
+// Copyright (c) Pervasive Displays Inc., 2021-2025
+// Copyright (c) Etigues, 2010-2025
+// Licence All rights reserved
+// For exclusive use with Pervasive Displays screens
+//
+// Release 1000: Initial release
+//
+// Usage: benchmark_board [report.json], default = standard output
+//
+
+// Benchmark
+#include "hV_Board_Benchmark.h"
+
+#if !defined(hV_HAL_HOST)
+#error Host back-end required
+#endif // hV_HAL_HOST
+
+int main(int argc, char * argv[])
+{
+    FILE * file = stdout;
+    if (argc > 1)
+    {
+        file = fopen(argv[1], "w");
+        if (file == 0)
+        {
+            fprintf(stderr, "Cannot open %s\n", argv[1]);
+            return 1;
+        }
+    }
+
+    hV_Board_Benchmark benchmark;
+    uint16_t number = benchmark.run(file);
+
+    if (file != stdout)
+    {
+        fclose(file);
+        printf("%i results written to %s\n", number, argv[1]);
+    }
+    return (number > 0) ? 0 : 1;
+}
@@ -0,0 +1,166 @@
+//
+// test_async.cpp
+// Test C++ code
+// ----------------------------------
+//
+// Details Checks of the asynchronous updates on the host back-end
+// Project Pervasive Displays Library Suite
+// Based on highView technology
+//
+// Created by Rei Vilo, 17 Oct 2026
+//
+// Copyright (c) Pervasive Displays Inc., 2021-2025
+// Copyright (c) Etigues, 2010-2025
+// Licence All rights reserved
+// For exclusive use with Pervasive Displays screens
+//
+// Release 1000: Initial release
+//
+
+// Driver
+#include "Driver_EPD_Host.h"
+
+#include <stdio.h>
+
+#if !defined(hV_HAL_HOST)
+#error Host back-end required
+#endif // hV_HAL_HOST
+
+static uint16_t h_failures = 0;
+
+///
+/// @brief Check a condition
+/// @param condition condition, true = pass
+/// @param text description
+///
+static void h_check(bool condition, const char * text)
+{
+    printf("%s %s\n", condition ? "PASS" : "FAIL", text);
+    if (condition == false)
+    {
+        h_failures += 1;
+    }
+}
+
+///
+/// @brief Size of the frame for 2.71"
+///
+#define FRAME_SIZE (264 * 176 / 8)
+
+///
+/// @brief Modelled refresh durations, ms
+/// @{
+#define DURATION_NORMAL 1000
+#define DURATION_FAST 400
+/// @}
+
+static uint8_t h_frameNext[FRAME_SIZE];
+static uint8_t h_framePrevious[FRAME_SIZE];
+
+///
+/// @brief Driver with access to the update number
+///
+class h_TestDriver: public Driver_EPD_Host
+{
+  public:
+    h_TestDriver()
+        : Driver_EPD_Host(SCREEN(SIZE_271, FILM_K, DRIVER_NONE), boardRaspberryPiPico_RP2040)
+    {
+        ;
+    }
+
+    void setUpdateNumber(uint16_t number)
+    {
+        u_updateNumber = number;
+    }
+
+    uint16_t getUpdateNumber()
+    {
+        return u_updateNumber;
+    }
+};
+
+static h_TestDriver h_driver;
+
+static void h_testClock()
+{
+    Driver_EPD_Handle handle = h_driver.updateFastAsync(h_frameNext, h_framePrevious, FRAME_SIZE);
+    uint32_t start = millis();
+
+    h_check((handle.isDone() == false) and (handle.getStatus() == UPDATE_STATUS_ONGOING), "Ongoing once the frames are sent");
+    h_check(handle.getElapsed() == 0, "Elapsed from the start of the refresh");
+
+    delay(DURATION_FAST / 2);
+    h_check((handle.isDone() == false) and (handle.getElapsed() == DURATION_FAST / 2), "Ongoing at half of the refresh, elapsed on the simulated clock");
+
+    delay(DURATION_FAST / 2 - 1);
+    h_check(handle.isDone() == false, "Ongoing 1 ms before the end of the refresh");
+
+    uint8_t status = handle.wait();
+    uint32_t elapsed = handle.getElapsed();
+    h_check((status == UPDATE_STATUS_DONE) and handle.isDone(), "Done after wait");
+    h_check((elapsed >= DURATION_FAST) and (elapsed <= DURATION_FAST + 1) and (millis() - start == elapsed), "Elapsed equals the modelled refresh duration");
+
+    delay(100);
+    h_check(handle.getElapsed() == elapsed, "Elapsed frozen once done");
+}
+
+static void h_testSuperseded()
+{
+    Driver_EPD_Handle handle1 = h_driver.updateFastAsync(h_frameNext, h_framePrevious, FRAME_SIZE);
+    delay(10);
+
+    // Next update completes the previous one first
+    Driver_EPD_Handle handle2 = h_driver.updateNormalAsync(h_frameNext, FRAME_SIZE);
+    h_check((handle1.isDone() == true) and (handle1.getStatus() == UPDATE_STATUS_DONE), "Superseded handle returns the recorded status");
+    uint32_t elapsed = handle1.getElapsed();
+    h_check((elapsed >= DURATION_FAST) and (elapsed <= DURATION_FAST + 1), "Superseded handle returns the recorded duration");
+    h_check(handle2.isDone() == false, "Next update ongoing");
+
+    // Superseded more than once
+    Driver_EPD_Handle handle3 = h_driver.updateFastAsync(h_frameNext, h_framePrevious, FRAME_SIZE);
+    h_check(handle2.isDone() and (handle2.getStatus() == UPDATE_STATUS_DONE) and (handle2.getElapsed() >= DURATION_NORMAL), "Second handle returns the recorded normal duration");
+
+    Driver_EPD_Handle handle4 = h_driver.updateFastAsync(h_frameNext, h_framePrevious, FRAME_SIZE);
+    Driver_EPD_Handle handle5 = h_driver.updateFastAsync(h_frameNext, h_framePrevious, FRAME_SIZE);
+    h_check(handle3.isDone() and (handle3.getStatus() == UPDATE_STATUS_DONE) and (handle3.getElapsed() == 0), "Handle superseded twice done, duration no longer available");
+    h_check(handle4.isDone() and (handle4.getElapsed() >= DURATION_FAST), "Handle superseded once keeps its duration");
+
+    handle5.wait();
+}
+
+static void h_testWrap()
+{
+    h_driver.setUpdateNumber(0xfffe);
+
+    Driver_EPD_Handle handle1 = h_driver.updateFastAsync(h_frameNext, h_framePrevious, FRAME_SIZE);
+    h_check(h_driver.getUpdateNumber() == 0xffff, "Update number 0xffff");
+
+    Driver_EPD_Handle handle2 = h_driver.updateFastAsync(h_frameNext, h_framePrevious, FRAME_SIZE);
+    h_check(h_driver.getUpdateNumber() == 0x0000, "Update number wrapped to 0x0000");
+    h_check(handle1.isDone() and (handle1.getElapsed() >= DURATION_FAST), "Handle before the wrap returns the recorded duration");
+    h_check(handle2.isDone() == false, "Handle after the wrap ongoing");
+
+    h_check((handle2.wait() == UPDATE_STATUS_DONE) and (handle2.getElapsed() >= DURATION_FAST), "Handle after the wrap done");
+
+    Driver_EPD_Handle handle3 = h_driver.updateFastAsync(h_frameNext, h_framePrevious, FRAME_SIZE);
+    h_check((h_driver.getUpdateNumber() == 0x0001) and (handle3.isDone() == false), "Update number 0x0001 ongoing");
+    handle3.wait();
+
+    Driver_EPD_Handle handle0;
+    h_check(handle0.isDone() and (handle0.getStatus() == UPDATE_STATUS_DONE), "Default handle done");
+}
+
+int main()
+{
+    h_driver.begin();
+    h_driver.setUpdateDuration(DURATION_NORMAL, DURATION_FAST);
+    hV_HAL_Host_setRecording(false);
+
+    h_testClock();
+    h_testSuperseded();
+    h_testWrap();
+
+    printf("%i failure(s)\n", h_failures);
+    return (h_failures == 0) ? 0 : 1;
+}
@@ -0,0 +1,576 @@
+//
+// test_host_bus.cpp
+// Test C++ code
+// ----------------------------------
+//
+// Details Checks of the send functions against the recorder of the host back-end
+// Project Pervasive Displays Library Suite
+// Based on highView technology
+//
+// Created by Rei Vilo, 17 Oct 2026
+//
+// Copyright (c) Pervasive Displays Inc., 2021-2025
+// Copyright (c) Etigues, 2010-2025
+// Licence All rights reserved
+// For exclusive use with Pervasive Displays screens
+//
+// Release 1000: Initial release
+//
+
+// Board
+#include "hV_Board.h"
+
+// Frame store
+#include "hV_Frame_Store.h"
+
+#include <stdio.h>
+
+#if !defined(hV_HAL_HOST)
+#error Host back-end required
+#endif // hV_HAL_HOST
+
+static uint16_t h_failures = 0;
+
+///
+/// @brief Check a condition
+/// @param condition condition, true = pass
+/// @param text description
+///
+static void h_check(bool condition, const char * text)
+{
+    printf("%s %s\n", condition ? "PASS" : "FAIL", text);
+    if (condition == false)
+    {
+        h_failures += 1;
+    }
+}
+
+///
+/// @brief Fake SPI device, answers the written byte plus one
+///
+class h_EchoDevice: public hV_HostDevice
+{
+  public:
+    uint8_t spiTransfer(uint8_t data)
+    {
+        return data + 1;
+    }
+};
+
+///
+/// @brief Fake SPI NOR flash, 1 MB, reads answer the low byte of the address
+/// @note Header of a valid slot 0 at address 0
+///
+class h_FlashDevice: public hV_HostDevice
+{
+  public:
+    void gpioWrite(uint8_t pin, uint8_t level)
+    {
+        (void)pin;
+        if (level == HIGH)
+        {
+            _count = 0; // /CS high, end of command
+        }
+    }
+
+    uint8_t spiTransfer(uint8_t data)
+    {
+        uint8_t result = 0x00;
+        if (_count == 0)
+        {
+            _command = data;
+            _address = 0;
+        }
+        else if (_command == 0x9f)
+        {
+            static const uint8_t identifier[3] = { 0xef, 0x40, 0x14 }; // 2^20 bytes
+            result = (_count <= 3) ? identifier[_count - 1] : 0x00;
+        }
+        else if (_command == 0x03)
+        {
+            if (_count <= 3)
+            {
+                _address = (_address << 8) | data;
+            }
+            else
+            {
+                result = _answer(_address + _count - 4);
+            }
+        }
+        _count += 1;
+        return result;
+    }
+
+  private:
+    ///
+    /// @brief Byte at an address
+    /// @param address address
+    /// @return header of slot 0, then the low byte of the address
+    /// @note Slot 0 valid, 600 bytes
+    ///
+    uint8_t _answer(uint32_t address)
+    {
+        static const uint8_t header[8] = { 0x68, 0x76, 0x46, 0x53, 0x58, 0x02, 0x00, 0x00 }; // "hvFS", 600
+        return (address < sizeof(header)) ? header[address] : (address & 0xff);
+    }
+
+    uint8_t _command = 0;
+    uint32_t _address = 0;
+    uint32_t _count = 0;
+};
+
+///
+/// @brief Board with access to the send functions
+///
+class h_TestBoard: public hV_Board
+{
+  public:
+    void begin(uint8_t family)
+    {
+        b_begin(boardRaspberryPiPico_RP2040, family, 50);
+        b_resume();
+        hV_HAL_SPI_begin();
+    }
+
+    void sendCommandData8(uint8_t command, uint8_t data)
+    {
+        b_sendCommandData8(command, data);
+    }
+
+    void sendIndexData(uint8_t index, const uint8_t * data, uint32_t size)
+    {
+        b_sendIndexData(index, data, size);
+    }
+
+    void sendIndexFixed(uint8_t index, uint8_t data, uint32_t size)
+    {
+        b_sendIndexFixed(index, data, size);
+    }
+
+    void sendIndexData(uint8_t index, frameProducer_t producer, uint32_t size, uint8_t * buffer, uint32_t length, void * context)
+    {
+        b_sendIndexData(index, producer, size, buffer, length, context);
+    }
+
+    void sendIndexDataWindow(uint8_t index, const uint8_t * data, uint32_t size, uint16_t stride, window_t window)
+    {
+        b_sendIndexDataWindow(index, data, size, stride, window);
+    }
+
+    bool suspendIdle(uint32_t idle)
+    {
+        b_setPowerProfile(POWER_MODE_AUTO, POWER_SCOPE_BUS_GPIO, idle);
+        hV_HAL_delayMilliseconds(idle);
+        bool result = b_checkIdle();
+        b_setPowerProfile(POWER_MODE_MANUAL);
+        return result;
+    }
+
+    void setGpioLost()
+    {
+        b_setGpioLost();
+    }
+
+    void resume()
+    {
+        b_resume();
+    }
+
+    void reset(uint32_t ms1, uint32_t ms2, uint32_t ms3, uint32_t ms4, uint32_t ms5)
+    {
+        b_reset(ms1, ms2, ms3, ms4, ms5);
+    }
+
+    void sendSequence(const uint8_t * sequence, uint16_t cog)
+    {
+        b_resetCOG = cog;
+        b_sendSequence(sequence);
+    }
+
+    bool sendIndexDataSplit(uint8_t index, const uint8_t * data, uint32_t size, uint16_t width)
+    {
+        return b_sendIndexDataSplit(index, data, size, width);
+    }
+
+    bool sendIndexStore(uint8_t index, hV_Frame_Store & store, uint8_t slot, uint8_t * buffer, uint32_t length)
+    {
+        return b_sendIndexStore(index, store, slot, buffer, length);
+    }
+};
+
+///
+/// @brief Get the records of a type
+/// @param type HOST_GPIO_DEFINE to HOST_WIRE_READ
+/// @return records
+///
+static std::vector<hostRecord_t> h_filter(uint8_t type)
+{
+    std::vector<hostRecord_t> result;
+    for (const hostRecord_t & record : hV_HAL_Host_getRecords())
+    {
+        if (record.type == type)
+        {
+            result.push_back(record);
+        }
+    }
+    return result;
+}
+
+static void h_testCommandData(h_TestBoard & board)
+{
+    const pins_t & pin = boardRaspberryPiPico_RP2040;
+
+    hV_HAL_Host_clear();
+    board.sendCommandData8(0x12, 0x34);
+
+    // DC low, CS low, command, DC high, data, CS high
+    std::vector<hostRecord_t> records;
+    for (const hostRecord_t & record : hV_HAL_Host_getRecords())
+    {
+        if ((record.type == HOST_GPIO_WRITE) or (record.type == HOST_SPI_BYTE))
+        {
+            records.push_back(record);
+        }
+    }
+
+    bool flagOrder = (records.size() == 6)
+                     and (records[0].type == HOST_GPIO_WRITE) and (records[0].pin == pin.panelDC) and (records[0].value == LOW)
+                     and (records[1].type == HOST_GPIO_WRITE) and (records[1].pin == pin.panelCS) and (records[1].value == LOW)
+                     and (records[2].type == HOST_SPI_BYTE) and (records[2].value == 0x12)
+                     and (records[3].type == HOST_GPIO_WRITE) and (records[3].pin == pin.panelDC) and (records[3].value == HIGH)
+                     and (records[4].type == HOST_SPI_BYTE) and (records[4].value == 0x34)
+                     and (records[5].type == HOST_GPIO_WRITE) and (records[5].pin == pin.panelCS) and (records[5].value == HIGH);
+    h_check(flagOrder, "b_sendCommandData8() command then data, within /CS");
+}
+
+static void h_testIndexData(h_TestBoard & board)
+{
+    uint8_t frame[1000];
+    for (uint16_t index = 0; index < sizeof(frame); index++)
+    {
+        frame[index] = index & 0xff;
+    }
+
+    hV_HAL_Host_clear();
+    board.sendIndexData(0x10, frame, sizeof(frame));
+
+    std::vector<hostRecord_t> bytes = h_filter(HOST_SPI_BYTE);
+    hostCounter_t counters = hV_HAL_Host_getCounters();
+
+    bool flagData = (bytes.size() == 1 + sizeof(frame)) and (bytes[0].value == 0x10);
+    for (uint16_t index = 0; flagData and (index < sizeof(frame)); index++)
+    {
+        flagData = (bytes[1 + index].value == frame[index]);
+    }
+    h_check(flagData, "b_sendIndexData() index then frame, byte for byte");
+    h_check(counters.spiByte == 1 + sizeof(frame), "b_sendIndexData() byte counter");
+    h_check(counters.spiCall == 2, "b_sendIndexData() one call for the index, one for the frame");
+}
+
+static void h_testIndexFixed(h_TestBoard & board)
+{
+    hV_HAL_Host_clear();
+    board.sendIndexFixed(0x13, 0xa5, 5000);
+
+    std::vector<hostRecord_t> bytes = h_filter(HOST_SPI_BYTE);
+    bool flagData = (bytes.size() == 5001) and (bytes[0].value == 0x13);
+    for (uint16_t index = 1; flagData and (index < bytes.size()); index++)
+    {
+        flagData = (bytes[index].value == 0xa5);
+    }
+    h_check(flagData, "b_sendIndexFixed() index then fixed value");
+}
+
+///
+/// @brief Faulty producer, claims more bytes than requested
+/// @note Context counts the calls
+///
+static uint32_t h_produce(uint8_t * buffer, uint32_t offset, uint32_t size, void * context)
+{
+    *(uint8_t *)context += 1;
+    for (uint32_t index = 0; index < size; index++)
+    {
+        buffer[index] = (offset + index) & 0xff;
+    }
+    return size + 16;
+}
+
+static void h_testProducer(h_TestBoard & board)
+{
+    uint8_t buffer[64];
+    uint8_t calls = 0;
+
+    hV_HAL_Host_clear();
+    board.sendIndexData(0x10, h_produce, 100, buffer, 16, &calls);
+
+    std::vector<hostRecord_t> bytes = h_filter(HOST_SPI_BYTE);
+    bool flagData = (bytes.size() == 101) and (bytes[0].value == 0x10);
+    for (uint8_t index = 0; flagData and (index < 100); index++)
+    {
+        flagData = (bytes[1 + index].value == index);
+    }
+    h_check(flagData, "b_sendIndexData() producer count clamped to the chunk");
+    h_check(calls == 13, "b_sendIndexData() context passed to the producer");
+}
+
+static void h_testSplit(h_TestBoard & board)
+{
+    // 3 rows of 4 bytes, halves of 2 bytes
+    const uint8_t frame[12] = { 0, 1, 10, 11, 2, 3, 12, 13, 4, 5, 14, 15 };
+
+    hV_HAL_Host_clear();
+    h_check(board.sendIndexDataSplit(0x10, frame, sizeof(frame), 4), "b_sendIndexDataSplit() full rows sent");
+
+    std::vector<hostRecord_t> bytes = h_filter(HOST_SPI_BYTE);
+    const uint8_t expected[14] = { 0x10, 0, 1, 2, 3, 4, 5, 0x10, 10, 11, 12, 13, 14, 15 };
+    bool flagData = (bytes.size() == sizeof(expected));
+    for (uint8_t index = 0; flagData and (index < sizeof(expected)); index++)
+    {
+        flagData = (bytes[index].value == expected[index]);
+    }
+    h_check(flagData, "b_sendIndexDataSplit() first halves to master, second halves to slave");
+
+    hV_HAL_Host_clear();
+    h_check(board.sendIndexDataSplit(0x10, frame, 10, 4) == false, "b_sendIndexDataSplit() partial row rejected");
+    h_check(hV_HAL_Host_getCounters().spiByte == 0, "b_sendIndexDataSplit() nothing sent on partial row");
+}
+
+static void h_testWindow(h_TestBoard & board)
+{
+    // 3 rows of 4 bytes, 32 x 3 pixels
+    const uint8_t frame[12] = { 0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11 };
+
+    // Window beyond the frame, clipped to columns 20 to 31 and rows 1 to 2
+    window_t window = { 20, 1, 100, 100 };
+    hV_HAL_Host_clear();
+    board.sendIndexDataWindow(0x10, frame, sizeof(frame), 4, window);
+
+    std::vector<hostRecord_t> bytes = h_filter(HOST_SPI_BYTE);
+    const uint8_t expected[5] = { 0x10, 6, 7, 10, 11 };
+    bool flagData = (bytes.size() == sizeof(expected));
+    for (uint8_t index = 0; flagData and (index < sizeof(expected)); index++)
+    {
+        flagData = (bytes[index].value == expected[index]);
+    }
+    h_check(flagData, "b_sendIndexDataWindow() window clipped to the frame");
+
+    // Window below the last row
+    window = { 0, 3, 8, 1 };
+    hV_HAL_Host_clear();
+    board.sendIndexDataWindow(0x10, frame, sizeof(frame), 4, window);
+    h_check(hV_HAL_Host_getCounters().spiByte == 0, "b_sendIndexDataWindow() nothing sent outside the frame");
+}
+
+static void h_testIdle(h_TestBoard & board)
+{
+    const pins_t & pin = boardRaspberryPiPico_RP2040;
+    hV_HAL_SPI_setProfile(SPI_PROFILE_DATA, 16000000);
+
+    // Bus ended, then restarted with the same profiles
+    h_check(board.suspendIdle(10), "b_checkIdle() suspends when idle");
+    board.resume();
+    hV_HAL_Host_clear();
+    hV_HAL_SPI_selectProfile(SPI_PROFILE_DATA);
+    std::vector<hostRecord_t> settings = h_filter(HOST_SPI_SETTINGS);
+    h_check((settings.size() == 1) and (settings[0].value == 16000), "b_resume() restarts the bus with the data profile");
+    hV_HAL_SPI_selectProfile(SPI_PROFILE_COMMAND);
+
+    // Bus held by the flash, kept
+    hV_HAL_SPI_defineDevice(SPI_DEVICE_FLASH, pin.flashCS);
+    hV_HAL_SPI_acquire(SPI_DEVICE_FLASH);
+    board.suspendIdle(10);
+    hV_HAL_SPI_release(SPI_DEVICE_FLASH);
+
+    // Settings applied only on a started bus
+    hV_HAL_SPI_defineDevice(SPI_DEVICE_CARD, pin.cardCS, 4000000);
+    hV_HAL_Host_clear();
+    hV_HAL_SPI_acquire(SPI_DEVICE_CARD);
+    h_check(h_filter(HOST_SPI_SETTINGS).size() == 1, "b_checkIdle() keeps the bus held by the flash");
+    hV_HAL_SPI_release(SPI_DEVICE_CARD);
+    board.resume();
+
+    // Panel settings applied again
+    hV_HAL_SPI_acquire(SPI_DEVICE_PANEL);
+    hV_HAL_SPI_release(SPI_DEVICE_PANEL);
+}
+
+static void h_testSequenceReset(h_TestBoard & board)
+{
+    const pins_t & pin = boardRaspberryPiPico_RP2040;
+    static const uint8_t sequence[] = { SEQUENCE_RESET, SEQUENCE_END };
+
+    // Cold then warm, profile of COG_FAST_SMALL { 200, 20, 200, 50, 5 }
+    board.setGpioLost();
+    for (uint8_t run = 0; run < 2; run++)
+    {
+        hV_HAL_Host_clear();
+        uint64_t start = hV_HAL_Host_getMicroseconds();
+        board.sendSequence(sequence, COG_FAST_SMALL);
+        uint64_t elapsed = hV_HAL_Host_getMicroseconds() - start;
+
+        uint8_t edges = 0;
+        for (const hostRecord_t & record : h_filter(HOST_GPIO_WRITE))
+        {
+            edges += (record.pin == pin.panelReset) ? 1 : 0;
+        }
+
+        if (run == 0)
+        {
+            h_check((edges == 3) and (elapsed >= 475000), "SEQUENCE_RESET cold reset with the profile of the COG");
+        }
+        else
+        {
+            h_check((edges == 2) and (elapsed >= 255000) and (elapsed < 275000), "SEQUENCE_RESET warm reset with the profile of the COG");
+        }
+    }
+
+    // Warm reset, delay beyond 65535 ms
+    uint64_t start = hV_HAL_Host_getMicroseconds();
+    board.reset(0, 0, 70000, 0, 0);
+    uint64_t elapsed = hV_HAL_Host_getMicroseconds() - start;
+    h_check((elapsed >= 70000000) and (elapsed < 70010000), "b_reset() delay beyond 65535 ms kept");
+}
+
+static void h_testClock()
+{
+    uint64_t start = hV_HAL_Host_getMicroseconds();
+    hV_HAL_delayMilliseconds(5);
+    h_check(hV_HAL_Host_getMicroseconds() - start == 5000, "Simulated clock advanced by delay");
+
+    // 1000 bytes at 8 MHz = 1 ms
+    hV_HAL_SPI_setProfile(SPI_PROFILE_DATA, 8000000);
+    hV_HAL_SPI_selectProfile(SPI_PROFILE_DATA);
+    uint8_t buffer[1000] = { 0 };
+    start = hV_HAL_Host_getMicroseconds();
+    hV_HAL_SPI_writeBuffer(buffer, sizeof(buffer));
+    h_check(hV_HAL_Host_getMicroseconds() - start == 1000, "Simulated clock advanced by SPI transfer");
+    hV_HAL_SPI_selectProfile(SPI_PROFILE_COMMAND);
+}
+
+static void h_testDevice()
+{
+    h_EchoDevice device;
+
+    hV_HAL_Host_setDevice(&device);
+    h_check(hV_HAL_SPI_transfer(0x41) == 0x42, "Fake device answers on SPI");
+    hV_HAL_Host_setDevice(0);
+    h_check(hV_HAL_SPI_transfer(0x41) == 0x00, "Default device answers 0x00");
+}
+
+static void h_testStore(h_TestBoard & board)
+{
+    h_FlashDevice device;
+    hV_Frame_Store store;
+    const pins_t & pin = boardRaspberryPiPico_RP2040;
+
+    hV_HAL_Host_setDevice(&device);
+
+    // 16 KB per slot, 64 slots fill 1 MB
+    h_check(store.begin(pin.flashCS, 15000, 0, 8000000, 64), "Frame store with slots within capacity");
+    h_check(store.begin(pin.flashCS, 15000, 0, 8000000, 65) == false, "Frame store with slots beyond capacity rejected");
+    h_check(store.begin(pin.flashCS, 15000, 4096, 8000000, 64) == false, "Frame store with base and slots beyond capacity rejected");
+
+    store.begin(pin.flashCS, 15000, 0, 8000000, 2);
+    uint8_t buffer[256];
+    hV_HAL_Host_clear();
+    uint32_t count = store.readFrame(1, 0, buffer, sizeof(buffer));
+    hostCounter_t counters = hV_HAL_Host_getCounters();
+
+    // Slot 1 at 16384, data after the 8-byte header
+    bool flagData = (count == sizeof(buffer));
+    for (uint16_t index = 0; flagData and (index < sizeof(buffer)); index++)
+    {
+        flagData = (buffer[index] == ((16384 + 8 + index) & 0xff));
+    }
+    h_check(flagData, "readFrame() data from the slot");
+    h_check(counters.spiCall == 5, "readFrame() command, address, then one block read");
+    h_check(store.readFrame(2, 0, buffer, sizeof(buffer)) == 0, "readFrame() slot beyond the layout rejected");
+
+    // Slot 0 of 600 bytes, three chunks
+    hV_HAL_Host_clear();
+    h_check(board.sendIndexStore(0x10, store, 0, buffer, sizeof(buffer)), "b_sendIndexStore() slot sent");
+
+    // Index first byte after each panel selection, then data of the chunk
+    const std::vector<hostRecord_t> & records = hV_HAL_Host_getRecords();
+    uint8_t chunks = 0;
+    uint32_t bytes = 0;
+    bool flagIndex = true;
+    bool flagSelected = false;
+    for (uint32_t index = 0; index < records.size(); index++)
+    {
+        const hostRecord_t & record = records[index];
+        if ((record.type == HOST_GPIO_WRITE) and (record.pin == pin.panelCS))
+        {
+            flagSelected = (record.value == LOW);
+            chunks += flagSelected ? 1 : 0;
+            bytes = 0;
+        }
+        else if (flagSelected and (record.type == HOST_SPI_BYTE))
+        {
+            flagIndex = flagIndex and ((bytes > 0) or (record.value == 0x10));
+            bytes += 1;
+        }
+    }
+    h_check((chunks == 3) and flagIndex, "b_sendIndexStore() index sent again before each chunk");
+
+    // Bus held by the card with /CS managed by the caller, no preemption
+    hV_HAL_SPI_acquire(SPI_DEVICE_CARD);
+    hV_HAL_Host_clear();
+    bool flagRefused = (board.sendIndexStore(0x10, store, 0, buffer, sizeof(buffer)) == false);
+    bool flagNone = true;
+    for (const hostRecord_t & record : hV_HAL_Host_getRecords())
+    {
+        flagNone = flagNone and not ((record.type == HOST_GPIO_WRITE) and (record.pin == pin.panelCS) and (record.value == LOW));
+    }
+    h_check(flagRefused and flagNone, "b_sendIndexStore() shared bus refused, nothing sent");
+    h_check(hV_HAL_SPI_getOwner() == SPI_DEVICE_CARD, "b_sendIndexStore() bus left to the card");
+    hV_HAL_SPI_release(SPI_DEVICE_CARD);
+
+    hV_HAL_Host_setDevice(0);
+}
+
+static void h_testArbiter()
+{
+    const pins_t & pin = boardRaspberryPiPico_RP2040;
+    hV_HAL_SPI_defineDevice(SPI_DEVICE_FLASH, pin.flashCS);
+
+    hV_HAL_Host_clear();
+    h_check(hV_HAL_SPI_acquire(SPI_DEVICE_FLASH) == SPI_DEVICE_NONE, "Flash acquires the free bus");
+    hV_HAL_SPI_transfer(0x9f);
+    hV_HAL_SPI_release(SPI_DEVICE_FLASH);
+
+    std::vector<hostRecord_t> writes = h_filter(HOST_GPIO_WRITE);
+    bool flagSelect = (writes.size() == 2)
+                      and (writes[0].pin == pin.flashCS) and (writes[0].value == LOW)
+                      and (writes[1].pin == pin.flashCS) and (writes[1].value == HIGH);
+    h_check(flagSelect, "Flash /CS managed by the arbiter");
+
+    // Panel /CS managed by the caller, no preemption
+    hV_HAL_SPI_acquire(SPI_DEVICE_PANEL);
+    h_check(hV_HAL_SPI_acquire(SPI_DEVICE_FLASH) == SPI_DEVICE_REFUSED, "Preemption of the panel refused");
+    h_check(hV_HAL_SPI_getOwner() == SPI_DEVICE_PANEL, "Panel keeps the bus");
+    hV_HAL_SPI_release(SPI_DEVICE_PANEL);
+    h_check(hV_HAL_SPI_getOwner() == SPI_DEVICE_NONE, "Bus free after release");
+}
+
+int main()
+{
+    h_TestBoard board;
+    board.begin(FAMILY_SMALL);
+
+    h_testCommandData(board);
+    h_testIndexData(board);
+    h_testIndexFixed(board);
+    h_testProducer(board);
+    h_testSplit(board);
+    h_testWindow(board);
+    h_testIdle(board);
+    h_testSequenceReset(board);
+    h_testClock();
+    h_testDevice();
+    h_testStore(board);
+    h_testArbiter();
+
+    printf("%i failure(s)\n", h_failures);
+    return (h_failures == 0) ? 0 : 1;
+}
@@ -0,0 +1,244 @@
+//
+// test_log.cpp
+// Test C++ code
+// ----------------------------------
+//
+// Details Checks of the deferred log on the host back-end
+// Project Pervasive Displays Library Suite
+// Based on highView technology
+//
+// Created by Rei Vilo, 17 Oct 2026
+//
+// Copyright (c) Pervasive Displays Inc., 2021-2025
+// Copyright (c) Etigues, 2010-2025
+// Licence All rights reserved
+// For exclusive use with Pervasive Displays screens
+//
+// Release 1000: Initial release
+//
+
+// Peripherals
+#include "hV_HAL_Peripherals.h"
+
+#include <stdio.h>
+#include <string>
+#include <unistd.h>
+
+#if !defined(hV_HAL_HOST)
+#error Host back-end required
+#endif // hV_HAL_HOST
+
+#if !defined(hV_HAL_LOG_DEFERRED)
+#error hV_HAL_LOG_DEFERRED required
+#endif // hV_HAL_LOG_DEFERRED
+
+static uint16_t h_failures = 0;
+
+///
+/// @brief Check a condition
+/// @param condition condition, true = pass
+/// @param text description
+///
+static void h_check(bool condition, const char * text)
+{
+    printf("%s %s\n", condition ? "PASS" : "FAIL", text);
+    if (condition == false)
+    {
+        h_failures += 1;
+    }
+}
+
+///
+/// @brief Capture of the console output
+///
+struct h_capture_t
+{
+    FILE * file; ///< temporary file
+    int saved; ///< standard output
+};
+
+static h_capture_t h_capture = { 0, -1 };
+
+///
+/// @brief Start capturing the console output
+///
+static void h_captureBegin()
+{
+    fflush(stdout);
+    h_capture.file = tmpfile();
+    h_capture.saved = dup(fileno(stdout));
+    dup2(fileno(h_capture.file), fileno(stdout));
+}
+
+///
+/// @brief Stop capturing the console output
+/// @return console output since h_captureBegin()
+///
+static std::string h_captureEnd()
+{
+    fflush(stdout);
+    dup2(h_capture.saved, fileno(stdout));
+    close(h_capture.saved);
+
+    std::string text;
+    char buffer[256];
+    size_t size;
+    rewind(h_capture.file);
+    while ((size = fread(buffer, 1, sizeof(buffer), h_capture.file)) > 0)
+    {
+        text.append(buffer, size);
+    }
+    fclose(h_capture.file);
+    return text;
+}
+
+///
+/// @brief Table of formats
+///
+static const char * const h_formats[] =
+{
+    "Value %u", // 0
+    "Temperature %.1f", // 1
+    "Signed %i char %c hex %04x", // 2
+    "Name %s value %i", // 3
+    "Float %.2f long %li", // 4
+};
+
+///
+/// @brief Formats registered at first use, one more than the table
+/// @note Distinct strings, formats identified by pointer
+///
+static const char h_dynamic[LOG_FORMAT_NUMBER + 1][16] =
+{
+    "Dynamic %i", "Dynamic %i", "Dynamic %i", "Dynamic %i",
+    "Dynamic %i", "Dynamic %i", "Dynamic %i", "Dynamic %i",
+    "Dynamic %i", "Dynamic %i", "Dynamic %i", "Dynamic %i",
+    "Dynamic %i", "Dynamic %i", "Dynamic %i", "Dynamic %i",
+    "Immediate %i"
+};
+
+static void h_testDynamic()
+{
+    hV_HAL_Log_clear();
+
+    h_captureBegin();
+    for (uint8_t index = 0; index < LOG_FORMAT_NUMBER + 1; index++)
+    {
+        hV_HAL_log(LEVEL_INFO, h_dynamic[index], index);
+    }
+    std::string immediate = h_captureEnd();
+
+    h_check(immediate == "hV _ Immediate 16\n", "Format past the table sent immediately");
+
+    logRecord_t records[LOG_FORMAT_NUMBER + 1];
+    uint32_t number = hV_HAL_Log_copy(records, LOG_FORMAT_NUMBER + 1);
+    bool flagDynamic = (number == LOG_FORMAT_NUMBER);
+    for (uint8_t index = 0; flagDynamic and (index < number); index++)
+    {
+        flagDynamic = (records[index].format == LOG_FORMAT_DYNAMIC + index) and (records[index].argument[0] == index);
+    }
+    h_check(flagDynamic, "Formats registered up to the table, recorded");
+
+    // Registered format reused
+    hV_HAL_log(LEVEL_INFO, h_dynamic[3], 33);
+    number = hV_HAL_Log_copy(records, 1);
+    h_check((number == 1) and (records[0].format == LOG_FORMAT_DYNAMIC + 3) and (records[0].argument[0] == 33), "Registered format reused");
+}
+
+static void h_testOverflow()
+{
+    hV_HAL_Log_setFormats(h_formats, 5);
+    hV_HAL_Log_clear();
+
+    for (uint32_t index = 0; index < LOG_LENGTH + 5; index++)
+    {
+        hV_HAL_Log_record(LEVEL_INFO, 0, 1, index);
+    }
+    h_check(hV_HAL_Log_getDropped() == 5, "Newest records dropped when full");
+
+    h_captureBegin();
+    uint16_t count = hV_HAL_Log_flush();
+    std::string text = h_captureEnd();
+
+    h_check(count == LOG_LENGTH, "All records kept flushed");
+    h_check(text.compare(0, 22, "hV _ Log dropped 5\nhV ") == 0, "Dropped records reported first on flush");
+    char last[32];
+    snprintf(last, sizeof(last), "hV _ Value %u\n", LOG_LENGTH - 1);
+    h_check((text.find("hV _ Value 0\n") != std::string::npos) and (text.size() >= strlen(last)) and (text.compare(text.size() - strlen(last), strlen(last), last) == 0), "Oldest records kept, in order");
+
+    h_captureBegin();
+    count = hV_HAL_Log_flush();
+    text = h_captureEnd();
+    h_check((count == 0) and (text.size() == 0), "Dropped records reported once");
+
+    for (uint32_t index = 0; index < LOG_LENGTH + 2; index++)
+    {
+        hV_HAL_Log_record(LEVEL_INFO, 0, 1, index);
+    }
+    h_captureBegin();
+    hV_HAL_Log_flush(1);
+    text = h_captureEnd();
+    h_check((text == "hV _ Log dropped 2\nhV _ Value 0\n") and (hV_HAL_Log_getDropped() == 7), "Dropped since last flush reported, total kept");
+
+    hV_HAL_Log_clear();
+    h_check((hV_HAL_Log_getDropped() == 0) and (hV_HAL_Log_copy(0, 0) == 0), "Clear resets the ring buffer and the counter");
+}
+
+static void h_testDecode()
+{
+    hV_HAL_Log_setFormats(h_formats, 5);
+    hV_HAL_Log_clear();
+
+    uint32_t time1 = micros();
+    hV_HAL_Log_record(LEVEL_DEBUG, 2, 3, (uint32_t)-5, (uint32_t)'A', (uint32_t)0xbeef);
+    delayMicroseconds(250);
+
+    float temperature = 21.5;
+    uint32_t bits;
+    memcpy(&bits, &temperature, sizeof(bits));
+    uint32_t time2 = micros();
+    hV_HAL_Log_record(LEVEL_SYSTEM, 1, 1, bits);
+    delayMicroseconds(250);
+
+    uint32_t time3 = micros();
+    hV_HAL_log(LEVEL_CRITICAL, h_formats[3], "abc", 7);
+    hV_HAL_log(LEVEL_INFO, h_formats[4], 1.25, -70000L);
+    hV_HAL_Log_record(LEVEL_INFO, 9, 0);
+
+    logRecord_t records[8];
+    uint32_t number = hV_HAL_Log_copy(records, 8);
+    h_check(number == 5, "Five records copied");
+
+    FILE * file = tmpfile();
+    hV_HAL_Log_decode(file, records, number);
+    std::string text;
+    char buffer[256];
+    size_t size;
+    rewind(file);
+    while ((size = fread(buffer, 1, sizeof(buffer), file)) > 0)
+    {
+        text.append(buffer, size);
+    }
+    fclose(file);
+
+    char expected[64];
+    snprintf(expected, sizeof(expected), "%10u - Signed -5 char A hex beef\n", time1);
+    h_check(text.find(expected) != std::string::npos, "Decoded integers, character and hexadecimal, debug level");
+    snprintf(expected, sizeof(expected), "%10u = Temperature 21.5\n", time2);
+    h_check(text.find(expected) != std::string::npos, "Decoded float, system level");
+    snprintf(expected, sizeof(expected), "%10u * Name ? value 7\n", time3);
+    h_check(text.find(expected) != std::string::npos, "String printed as ?, critical level");
+    h_check(text.find(" . Float 1.25 long -70000\n") != std::string::npos, "Double and long from hV_HAL_log()");
+    h_check(text.find(" . Format 9\n") != std::string::npos, "Unknown format identified by number");
+}
+
+int main()
+{
+    // Dynamic formats first, table empty
+    h_testDynamic();
+    h_testOverflow();
+    h_testDecode();
+
+    printf("%i failure(s)\n", h_failures);
+    return (h_failures == 0) ? 0 : 1;
+}
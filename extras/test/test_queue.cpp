@@ -0,0 +1,264 @@
+//
+// test_queue.cpp
+// Test C++ code
+// ----------------------------------
+//
+// Details Checks of the update queue on the host back-end
+// Project Pervasive Displays Library Suite
+// Based on highView technology
+//
+// Created by Rei Vilo, 17 Oct 2026
+//
+// Copyright (c) Pervasive Displays Inc., 2021-2025
+// Copyright (c) Etigues, 2010-2025
+// Licence All rights reserved
+// For exclusive use with Pervasive Displays screens
+//
+// Release 1000: Initial release
+//
+
+// Queue
+#include "Driver_EPD_Queue.h"
+
+#include <stdio.h>
+
+#if !defined(hV_HAL_HOST)
+#error Host back-end required
+#endif // hV_HAL_HOST
+
+static uint16_t h_failures = 0;
+
+///
+/// @brief Check a condition
+/// @param condition condition, true = pass
+/// @param text description
+///
+static void h_check(bool condition, const char * text)
+{
+    printf("%s %s\n", condition ? "PASS" : "FAIL", text);
+    if (condition == false)
+    {
+        h_failures += 1;
+    }
+}
+
+///
+/// @brief Size of the queued frames
+///
+#define FRAME_SIZE 8
+
+///
+/// @brief Frames filled with their identifier
+///
+static uint8_t h_frames[10][2 * FRAME_SIZE];
+
+///
+/// @brief Physical update received by the driver
+/// @note Frames identified by their first byte
+///
+struct h_update_t
+{
+    char type; ///< 'N' = normal, '2' = normal with two frames, 'F' = fast
+    uint8_t frame1; ///< first byte of frame1
+    uint8_t frame2; ///< first byte of frame2, 0 = none
+    uint32_t size; ///< size of the frame
+};
+
+///
+/// @brief Driver counting the physical updates
+///
+class h_CountingDriver: public Driver_EPD_Virtual
+{
+  public:
+
+    void updateNormal(FRAMEBUFFER_CONST_TYPE frame, uint32_t sizeFrame)
+    {
+        _add({ 'N', frame[0], 0, sizeFrame });
+    }
+
+    void updateNormal(FRAMEBUFFER_CONST_TYPE frame1, FRAMEBUFFER_CONST_TYPE frame2, uint32_t sizeFrame)
+    {
+        _add({ '2', frame1[0], frame2[0], sizeFrame });
+    }
+
+    void updateFast(FRAMEBUFFER_CONST_TYPE frame1, FRAMEBUFFER_CONST_TYPE frame2, uint32_t sizeFrame)
+    {
+        _add({ 'F', frame1[0], frame2[0], sizeFrame });
+    }
+
+    ///
+    /// @brief Set a request sent during the next update
+    /// @param request function called once from the update, 0 = none
+    ///
+    void setRequest(void (* request)(void))
+    {
+        _request = request;
+    }
+
+    h_update_t updates[8];
+    uint8_t number = 0;
+
+  private:
+
+    void _add(h_update_t update)
+    {
+        if (number < 8)
+        {
+            updates[number++] = update;
+        }
+
+        // Interrupt or other task during the update
+        if (_request != 0)
+        {
+            void (* request)(void) = _request;
+            _request = 0;
+            request();
+        }
+    }
+
+    void (* _request)(void) = 0;
+};
+
+static h_CountingDriver h_driver;
+static Driver_EPD_Queue h_queue(&h_driver);
+static uint8_t h_buffer[2 * FRAME_SIZE];
+
+///
+/// @brief Check an update
+/// @param index index of the update
+/// @param type expected type
+/// @param frame1 expected first frame
+/// @param frame2 expected second frame, 0 = none
+/// @param size expected size
+/// @return true if as expected
+///
+static bool h_isUpdate(uint8_t index, char type, uint8_t frame1, uint8_t frame2, uint32_t size = FRAME_SIZE)
+{
+    if (index >= h_driver.number)
+    {
+        return false;
+    }
+    const h_update_t & update = h_driver.updates[index];
+    return (update.type == type) and (update.frame1 == frame1) and (update.frame2 == frame2) and (update.size == size);
+}
+
+///
+/// @brief Restart the queue and the driver counters
+/// @param latency latency bound, ms
+///
+static void h_restart(uint32_t latency)
+{
+    h_driver.number = 0;
+    h_driver.setRequest(0);
+    h_queue.begin(h_buffer, FRAME_SIZE, latency);
+}
+
+static void h_testFastFast()
+{
+    h_restart(500);
+    h_queue.updateFast(h_frames[1], h_frames[2], FRAME_SIZE);
+    h_queue.updateFast(h_frames[3], h_frames[4], FRAME_SIZE);
+    h_check((h_queue.getPending() == QUEUE_UPDATE_FAST) and (h_driver.number == 0), "Fast and fast pending as fast");
+
+    h_queue.flush();
+    h_check((h_driver.number == 1) and h_isUpdate(0, 'F', 3, 2), "Fast and fast coalesced, newest image against first previous image");
+    h_check((h_queue.getCounters().requests == 2) and (h_queue.getCounters().updates == 1), "Two requests, one update");
+}
+
+static void h_testNormalFast()
+{
+    h_restart(500);
+    h_queue.updateFast(h_frames[1], h_frames[2], FRAME_SIZE);
+    h_queue.updateNormal(h_frames[3], FRAME_SIZE);
+    h_check(h_queue.getPending() == QUEUE_UPDATE_NORMAL, "Normal absorbs pending fast");
+
+    h_queue.updateFast(h_frames[4], h_frames[5], FRAME_SIZE);
+    h_check(h_queue.getPending() == QUEUE_UPDATE_NORMAL, "Fast after normal keeps normal");
+
+    h_queue.flush();
+    h_check((h_driver.number == 1) and h_isUpdate(0, 'N', 4, 0), "Normal update with newest image");
+}
+
+static void h_testNormal2Fast()
+{
+    h_restart(500);
+    h_queue.updateNormal(h_frames[1], h_frames[2], FRAME_SIZE);
+    h_queue.updateFast(h_frames[3], h_frames[4], FRAME_SIZE);
+    h_check(h_queue.getPending() == QUEUE_UPDATE_NORMAL_2, "Fast after normal with two frames keeps two frames");
+
+    h_queue.flush();
+    h_check((h_driver.number == 1) and h_isUpdate(0, '2', 3, 2), "Newest black frame with red frame kept");
+}
+
+static void h_testBypass()
+{
+    h_restart(500);
+    h_queue.updateFast(h_frames[1], h_frames[2], FRAME_SIZE);
+    h_queue.updateNormal(h_frames[3], 2 * FRAME_SIZE);
+
+    h_check((h_driver.number == 2) and h_isUpdate(0, 'F', 1, 2) and h_isUpdate(1, 'N', 3, 0, 2 * FRAME_SIZE), "Other size flushes pending update, then bypasses");
+    h_check((h_queue.getPending() == QUEUE_UPDATE_NONE) and (h_queue.getCounters().bypass == 1) and (h_queue.getCounters().updates == 1), "Bypass counted, no update pending");
+}
+
+static void h_testLatency()
+{
+    h_restart(500);
+    h_queue.updateFast(h_frames[1], h_frames[2], FRAME_SIZE);
+
+    delay(300);
+    h_queue.updateFast(h_frames[3], h_frames[4], FRAME_SIZE);
+    delay(199);
+    h_check((h_queue.process() == false) and (h_driver.number == 0), "Held before the latency bound");
+
+    // Bound counted from the first pending request
+    delay(1);
+    h_check((h_queue.process() == true) and (h_driver.number == 1) and h_isUpdate(0, 'F', 3, 2), "Run at the latency bound");
+    h_check(h_queue.process() == false, "Nothing pending after the update");
+
+    h_restart(0);
+    h_queue.updateFast(h_frames[1], h_frames[2], FRAME_SIZE);
+    h_check((h_driver.number == 1) and (h_queue.getPending() == QUEUE_UPDATE_NONE), "No latency bound, update at once");
+}
+
+static void h_requestLate()
+{
+    h_queue.updateFast(h_frames[5], h_frames[6], FRAME_SIZE);
+    h_queue.updateFast(h_frames[7], h_frames[8], FRAME_SIZE);
+    h_queue.updateNormal(h_frames[9], 2 * FRAME_SIZE);
+}
+
+static void h_testLate()
+{
+    h_restart(500);
+    h_queue.updateFast(h_frames[1], h_frames[2], FRAME_SIZE);
+    h_driver.setRequest(h_requestLate);
+    h_queue.flush();
+
+    h_check((h_driver.number == 1) and h_isUpdate(0, 'F', 1, 2), "Late requests not sent during the update");
+    h_check(h_queue.getCounters().rejected == 1, "Late request with other size rejected");
+    h_check(h_queue.getPending() == QUEUE_UPDATE_FAST, "Late requests queued once the update ends");
+
+    // Frames copied when the update ended, caller may reuse them
+    h_frames[7][0] = 0xee;
+    h_queue.flush();
+    h_check((h_driver.number == 2) and h_isUpdate(1, 'F', 7, 6), "Late fast requests coalesced, newest image against first previous image");
+    h_frames[7][0] = 7;
+}
+
+int main()
+{
+    for (uint8_t index = 0; index < 10; index++)
+    {
+        memset(h_frames[index], index, sizeof(h_frames[index]));
+    }
+
+    h_testFastFast();
+    h_testNormalFast();
+    h_testNormal2Fast();
+    h_testBypass();
+    h_testLatency();
+    h_testLate();
+
+    printf("%i failure(s)\n", h_failures);
+    return (h_failures == 0) ? 0 : 1;
+}
@@ -0,0 +1,190 @@
+//
+// test_temperature.cpp
+// Test C++ code
+// ----------------------------------
+//
+// Details Checks of the temperature bands and cache of update parameters on the host back-end
+// Project Pervasive Displays Library Suite
+// Based on highView technology
+//
+// Created by Rei Vilo, 17 Oct 2026
+//
+// Copyright (c) Pervasive Displays Inc., 2021-2025
+// Copyright (c) Etigues, 2010-2025
+// Licence All rights reserved
+// For exclusive use with Pervasive Displays screens
+//
+// Release 1000: Initial release
+//
+
+// Driver
+#include "Driver_EPD_Host.h"
+
+#include <stdio.h>
+
+#if !defined(hV_HAL_HOST)
+#error Host back-end required
+#endif // hV_HAL_HOST
+
+static uint16_t h_failures = 0;
+
+///
+/// @brief Check a condition
+/// @param condition condition, true = pass
+/// @param text description
+///
+static void h_check(bool condition, const char * text)
+{
+    printf("%s %s\n", condition ? "PASS" : "FAIL", text);
+    if (condition == false)
+    {
+        h_failures += 1;
+    }
+}
+
+///
+/// @brief Size of the frame for 2.71"
+///
+#define FRAME_SIZE (264 * 176 / 8)
+
+static uint8_t h_frameNext[FRAME_SIZE];
+static uint8_t h_framePrevious[FRAME_SIZE];
+
+///
+/// @brief Driver counting the computations of the update parameters
+///
+class h_TestDriver: public Driver_EPD_Host
+{
+  public:
+    h_TestDriver()
+        : Driver_EPD_Host(SCREEN(SIZE_271, FILM_K, DRIVER_NONE), boardRaspberryPiPico_RP2040)
+    {
+        ;
+    }
+
+    uint8_t getBand(int8_t temperatureC)
+    {
+        return d_getTemperatureBand(temperatureC);
+    }
+
+    const updateParameters_t & getParameters()
+    {
+        return u_getParameters();
+    }
+
+    void setCOG(uint16_t cog)
+    {
+        d_COG = cog;
+    }
+
+    uint32_t computations = 0;
+
+  protected:
+
+    void d_computeParameters(int8_t temperatureC, updateParameters_t & parameters)
+    {
+        computations++;
+        Driver_EPD_Host::d_computeParameters(temperatureC, parameters);
+    }
+};
+
+static h_TestDriver h_driver;
+
+static void h_testBands()
+{
+    h_check((h_driver.getBand(-128) == 0) and (h_driver.getBand(-41) == 0), "Below the minimum, first band");
+    h_check((h_driver.getBand(-40) == 0) and (h_driver.getBand(-31) == 0), "First band, -40 to -31 °C");
+    h_check(h_driver.getBand(-30) == 1, "Second band from -30 °C");
+    h_check((h_driver.getBand(-1) == 3) and (h_driver.getBand(0) == 4) and (h_driver.getBand(9) == 4) and (h_driver.getBand(10) == 5), "Bands around 0 °C");
+    h_check((h_driver.getBand(79) == 11) and (h_driver.getBand(80) == TEMPERATURE_BAND_NUMBER - 1) and (h_driver.getBand(89) == TEMPERATURE_BAND_NUMBER - 1), "Last band, 80 to 89 °C");
+    h_check((h_driver.getBand(90) == TEMPERATURE_BAND_NUMBER - 1) and (h_driver.getBand(127) == TEMPERATURE_BAND_NUMBER - 1), "Above the maximum, last band");
+}
+
+static void h_testCache()
+{
+    h_driver.computations = 0;
+    h_driver.setTemperatureC(25);
+    h_check(h_driver.computations == 1, "Computed at first use of the band");
+
+    const updateParameters_t & parameters = h_driver.getParameters();
+    h_check(parameters.flagValid and (parameters.length == HOST_PARAMETER_NUMBER), "Parameters valid");
+    h_check((parameters.data[HOST_PARAMETER_TEMPERATURE] == 20) and (parameters.data[HOST_PARAMETER_TEMPERATURE_FAST] == 20 + 0x40) and (parameters.data[HOST_PARAMETER_DURATION] == 100), "Parameters of the band 20 to 29 °C, film K");
+
+    h_driver.setTemperatureC(20);
+    h_driver.setTemperatureC(29);
+    h_driver.getParameters();
+    h_check(h_driver.computations == 1, "Same band, cache hit without computation");
+
+    h_driver.setTemperatureC(19);
+    h_check((h_driver.computations == 2) and (h_driver.getParameters().data[HOST_PARAMETER_TEMPERATURE] == 10), "Other band computed");
+
+    h_driver.setTemperatureC(25);
+    h_check(h_driver.computations == 2, "Back to first band, cache hit without computation");
+}
+
+static void h_testCOG()
+{
+    h_driver.computations = 0;
+    h_driver.setCOG(COG(FILM_E, FAMILY_SMALL));
+    const updateParameters_t & parameters = h_driver.getParameters();
+    h_check(h_driver.computations == 1, "Change of COG invalidates the cache");
+    h_check(parameters.data[HOST_PARAMETER_TEMPERATURE_FAST] == 20, "Parameters of the new COG, no fast offset for film E");
+
+    h_driver.setTemperatureC(19);
+    h_check(h_driver.computations == 2, "Other bands invalidated too");
+
+    h_driver.setTemperatureC(25);
+    h_driver.getParameters();
+    h_check(h_driver.computations == 2, "New COG cached");
+
+    h_driver.setCOG(COG(FILM_K, FAMILY_SMALL));
+    h_driver.setTemperatureC(25);
+    h_check(h_driver.computations == 3, "Back to the first COG, computed again");
+}
+
+static void h_testUpdate()
+{
+    h_driver.setUpdateDuration(1000, 400);
+    h_driver.setTemperatureC(-5);
+
+    hV_HAL_Host_clear();
+    h_driver.clearStatistics();
+    h_driver.updateFast(h_frameNext, h_framePrevious, FRAME_SIZE);
+
+    // Register 0xe5 with the temperature of the band -10 to -1 °C, fast offset
+    const std::vector<hostRecord_t> & records = hV_HAL_Host_getRecords();
+    uint32_t index = 0;
+    while ((index < records.size()) and not ((records[index].type == HOST_SPI_BYTE) and (records[index].value == 0xe5)))
+    {
+        index++;
+    }
+    index++;
+    while ((index < records.size()) and (records[index].type != HOST_SPI_BYTE))
+    {
+        index++;
+    }
+    bool flagFound = (index < records.size()) and (records[index].value == (uint8_t)(-10 + 0x40));
+    h_check(flagFound, "Temperature of the band sent to register 0xe5");
+
+    uint64_t refresh = h_driver.getStatistics().refresh;
+    h_check((refresh >= 1000000) and (refresh < 1001000), "Fast refresh at 250 % below 0 °C");
+
+    h_driver.setTemperatureC(25);
+    h_driver.clearStatistics();
+    h_driver.updateFast(h_frameNext, h_framePrevious, FRAME_SIZE);
+    refresh = h_driver.getStatistics().refresh;
+    h_check((refresh >= 400000) and (refresh < 401000), "Fast refresh at 25 °C");
+}
+
+int main()
+{
+    h_driver.begin();
+
+    h_testBands();
+    h_testCache();
+    h_testCOG();
+    h_testUpdate();
+
+    printf("%i failure(s)\n", h_failures);
+    return (h_failures == 0) ? 0 : 1;
+}
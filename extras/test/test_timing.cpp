@@ -0,0 +1,289 @@
+//
+// test_timing.cpp
+// Test C++ code
+// ----------------------------------
+//
+// Details Checks of the timing profiles and offline calibration on the host back-end
+// Project Pervasive Displays Library Suite
+// Based on highView technology
+//
+// Created by Rei Vilo, 17 Oct 2026
+//
+// Copyright (c) Pervasive Displays Inc., 2021-2025
+// Copyright (c) Etigues, 2010-2025
+// Licence All rights reserved
+// For exclusive use with Pervasive Displays screens
+//
+// Release 1000: Initial release
+//
+
+// Board
+#include "hV_Board.h"
+
+#include <stdio.h>
+
+#if !defined(hV_HAL_HOST)
+#error Host back-end required
+#endif // hV_HAL_HOST
+
+static uint16_t h_failures = 0;
+
+///
+/// @brief Check a condition
+/// @param condition condition, true = pass
+/// @param text description
+///
+static void h_check(bool condition, const char * text)
+{
+    printf("%s %s\n", condition ? "PASS" : "FAIL", text);
+    if (condition == false)
+    {
+        h_failures += 1;
+    }
+}
+
+///
+/// @brief Minimum delays required by the modelled panel, us
+/// @note Slave: /CSS select to first byte at least setup + slave,
+/// /CS unselect to /CSS unselect at least slave
+///
+static const timing_t h_minimum = { 12, 20, 8, 30 };
+
+///
+/// @brief Board with access to the timing functions
+///
+class h_TestBoard: public hV_Board
+{
+  public:
+    void begin(pins_t board, uint8_t family)
+    {
+        b_begin(board, family, 50);
+        b_resume();
+        hV_HAL_SPI_begin();
+        hV_HAL_SPI_setProfile(SPI_PROFILE_DATA, 16000000); // Switch recorded
+    }
+
+    timing_t getTiming()
+    {
+        return b_getTiming();
+    }
+
+    bool calibrate(bool (* check)(void))
+    {
+        return b_calibrateTiming(check);
+    }
+
+    void sendIndexData(uint8_t index, const uint8_t * data, uint32_t size)
+    {
+        b_sendIndexData(index, data, size);
+    }
+
+    void sendCommandDataSelect8(uint8_t command, uint8_t data)
+    {
+        b_sendCommandDataSelect8(command, data);
+    }
+
+    uint8_t getFamily()
+    {
+        return b_family;
+    }
+
+    pins_t getPins()
+    {
+        return b_pin;
+    }
+};
+
+static h_TestBoard h_board;
+
+///
+/// @brief Check the slave edges on a selection of both halves
+/// @return true if /CSS select to first byte meets setup + slave
+/// @note Selection with panelCSS on small and medium screens
+///
+static bool h_checkRecordedSelect()
+{
+    pins_t pin = h_board.getPins();
+
+    hV_HAL_Host_clear();
+    h_board.sendCommandDataSelect8(0x00, 0x0e);
+
+    uint64_t timeSelectSlave = 0; // /CSS low
+    bool flagSlave = false;
+
+    for (const hostRecord_t & record : hV_HAL_Host_getRecords())
+    {
+        if ((record.type == HOST_GPIO_WRITE) and (record.pin == pin.panelCSS) and (record.value == LOW))
+        {
+            timeSelectSlave = record.time;
+            flagSlave = true;
+        }
+        else if (record.type == HOST_SPI_BYTE)
+        {
+            return flagSlave and (record.time - timeSelectSlave >= h_minimum.setup + h_minimum.slave);
+        }
+    }
+    return false;
+}
+
+///
+/// @brief Send a known command and check the recorded bus timing against the modelled panel
+/// @return true if all the edges meet the minimum delays
+/// @note Slave edges checked on FAMILY_LARGE or with panelCSS connected
+///
+static bool h_checkRecorded()
+{
+    static const uint8_t data[4] = { 0x01, 0x02, 0x03, 0x04 };
+    pins_t pin = h_board.getPins();
+
+    hV_HAL_Host_clear();
+    h_board.sendIndexData(0x10, data, sizeof(data));
+
+    uint64_t timeSelect = 0; // /CS low
+    uint64_t timeIndex = 0; // index byte
+    uint64_t timeData = 0; // DC high
+    uint64_t timeFirst = 0; // first data byte
+    uint64_t timeUnselect = 0; // /CS high
+    uint64_t timeSelectSlave = 0; // /CSS low
+    uint64_t timeUnselectSlave = 0; // /CSS high
+    bool flagSlave = false;
+    uint32_t clock = 0; // kHz, data profile
+    uint8_t bytes = 0;
+
+    for (const hostRecord_t & record : hV_HAL_Host_getRecords())
+    {
+        if ((record.type == HOST_GPIO_WRITE) and (record.pin == pin.panelCS))
+        {
+            if (record.value == LOW)
+            {
+                timeSelect = record.time;
+            }
+            else
+            {
+                timeUnselect = record.time;
+            }
+        }
+        else if ((record.type == HOST_GPIO_WRITE) and (pin.panelCSS != NOT_CONNECTED) and (record.pin == pin.panelCSS))
+        {
+            if (record.value == LOW)
+            {
+                timeSelectSlave = record.time;
+                flagSlave = true;
+            }
+            else
+            {
+                timeUnselectSlave = record.time;
+            }
+        }
+        else if ((record.type == HOST_GPIO_WRITE) and (record.pin == pin.panelDC) and (record.value == HIGH))
+        {
+            timeData = record.time;
+        }
+        else if ((record.type == HOST_SPI_SETTINGS) and (timeData > 0) and (bytes == 1))
+        {
+            clock = record.value;
+        }
+        else if (record.type == HOST_SPI_BYTE)
+        {
+            if (bytes == 0)
+            {
+                timeIndex = record.time;
+            }
+            else if (bytes == 1)
+            {
+                timeFirst = record.time;
+            }
+            bytes += 1;
+        }
+    }
+
+    if ((bytes != 1 + sizeof(data)) or (clock == 0))
+    {
+        return false;
+    }
+
+    // Data bytes sent as one block, end of block from the clock
+    uint64_t timeLast = timeFirst + (8000ULL * sizeof(data) + clock - 1) / clock;
+
+    bool result = (timeIndex - timeSelect >= h_minimum.setup)
+                  and (timeFirst - timeData >= h_minimum.phase)
+                  and (timeUnselect - timeLast >= h_minimum.hold);
+
+    if (h_board.getFamily() == FAMILY_LARGE)
+    {
+        // Both halves selected
+        result = result and flagSlave
+                 and (timeIndex - timeSelectSlave >= h_minimum.setup + h_minimum.slave)
+                 and (timeUnselectSlave - timeUnselect >= h_minimum.slave);
+    }
+    else if (pin.panelCSS != NOT_CONNECTED)
+    {
+        result = result and h_checkRecordedSelect();
+    }
+    return result;
+}
+
+static void h_testDefault()
+{
+    pins_t board = boardRaspberryPiPico_RP2040;
+
+    // Same delays as before the timing profiles
+    h_board.begin(board, FAMILY_SMALL);
+    timing_t timing = h_board.getTiming();
+    h_check((timing.setup == 50) and (timing.phase == 50) and (timing.hold == 50), "Default delays from delayCS");
+    h_check(timing.slave == 450, "Slave delay with panelCSS connected");
+
+    board.panelCSS = NOT_CONNECTED;
+    h_board.begin(board, FAMILY_MEDIUM);
+    h_check(h_board.getTiming().slave == 0, "No slave delay without panelCSS");
+
+    h_board.begin(board, FAMILY_LARGE);
+    h_check(h_board.getTiming().slave == 450, "Slave delay on FAMILY_LARGE");
+}
+
+static void h_testCalibration()
+{
+    h_board.begin(boardRaspberryPiPico_RP2040, FAMILY_SMALL);
+    h_check(h_checkRecorded(), "Default profile meets the modelled panel");
+
+    bool flagCalibrated = h_board.calibrate(h_checkRecorded);
+    timing_t timing = h_board.getTiming();
+    printf("     Calibrated setup %i, phase %i, hold %i, slave %i us\n", timing.setup, timing.phase, timing.hold, timing.slave);
+
+    h_check(flagCalibrated, "Calibration against the recorded bus");
+    h_check(h_checkRecorded(), "Calibrated profile meets the modelled panel");
+    h_check((timing.setup < 50) and (timing.phase < 50) and (timing.hold < 50), "Calibrated profile shorter than default");
+    h_check((timing.setup <= h_minimum.setup * 5 / 4 + 1) and (timing.phase <= h_minimum.phase * 5 / 4 + 1) and (timing.hold <= h_minimum.hold * 5 / 4 + 1), "Calibrated profile within margin");
+    h_check(timing.slave >= h_minimum.slave, "Calibrated slave delay kept with panelCSS connected");
+
+    // Cached for the next initialisation of the same family
+    h_board.begin(boardRaspberryPiPico_RP2040, FAMILY_SMALL);
+    h_check(h_board.getTiming().setup == timing.setup, "Calibrated profile cached per family");
+}
+
+static void h_testCalibrationLarge()
+{
+    h_board.begin(boardRaspberryPiPico_RP2040, FAMILY_LARGE);
+    h_check(h_checkRecorded(), "Default profile meets the modelled panel on FAMILY_LARGE");
+
+    bool flagCalibrated = h_board.calibrate(h_checkRecorded);
+    timing_t timing = h_board.getTiming();
+    printf("     Calibrated setup %i, phase %i, hold %i, slave %i us\n", timing.setup, timing.phase, timing.hold, timing.slave);
+
+    h_check(flagCalibrated, "Calibration against the recorded bus on FAMILY_LARGE");
+    h_check(h_checkRecorded(), "Calibrated profile meets the modelled panel on FAMILY_LARGE");
+    h_check(timing.slave >= h_minimum.slave, "Calibrated slave delay at or above the minimum on FAMILY_LARGE");
+    h_check(timing.slave < 450, "Calibrated slave delay shorter than default");
+}
+
+int main()
+{
+    hV_HAL_Host_setRecording(true);
+
+    h_testDefault();
+    h_testCalibration();
+    h_testCalibrationLarge();
+
+    printf("%i failure(s)\n", h_failures);
+    return (h_failures == 0) ? 0 : 1;
+}
@@ -0,0 +1,157 @@
+//
+// test_trace.cpp
+// Test C++ code
+// ----------------------------------
+//
+// Details Checks of the bus trace dump and exports on the host back-end
+// Project Pervasive Displays Library Suite
+// Based on highView technology
+//
+// Created by Rei Vilo, 17 Oct 2026
+//
+// Copyright (c) Pervasive Displays Inc., 2021-2025
+// Copyright (c) Etigues, 2010-2025
+// Licence All rights reserved
+// For exclusive use with Pervasive Displays screens
+//
+// Release 1000: Initial release
+//
+// Usage: test_trace, files trace_test.txt, .vcd and .json in the current folder
+//
+
+// Peripherals
+#include "hV_HAL_Peripherals.h"
+
+#include <stdio.h>
+#include <string>
+
+#if !defined(hV_HAL_HOST)
+#error Host back-end required
+#endif // hV_HAL_HOST
+
+#if !defined(hV_HAL_TRACE)
+#error hV_HAL_TRACE required
+#endif // hV_HAL_TRACE
+
+static uint16_t h_failures = 0;
+
+///
+/// @brief Check a condition
+/// @param condition condition, true = pass
+/// @param text description
+///
+static void h_check(bool condition, const char * text)
+{
+    printf("%s %s\n", condition ? "PASS" : "FAIL", text);
+    if (condition == false)
+    {
+        h_failures += 1;
+    }
+}
+
+///
+/// @brief Read a file
+/// @param name file name
+/// @return content, empty if not found
+///
+static std::string h_readFile(const char * name)
+{
+    std::string text;
+    FILE * file = fopen(name, "r");
+    if (file != 0)
+    {
+        char buffer[256];
+        size_t size;
+        while ((size = fread(buffer, 1, sizeof(buffer), file)) > 0)
+        {
+            text.append(buffer, size);
+        }
+        fclose(file);
+    }
+    return text;
+}
+
+///
+/// @brief Check a text contains a formatted string
+/// @param text text
+/// @param format format of the expected string
+/// @param value value for the format
+/// @return true if found
+///
+static bool h_contains(const std::string & text, const char * format, unsigned long value)
+{
+    char expected[128];
+    snprintf(expected, sizeof(expected), format, value);
+    return (text.find(expected) != std::string::npos);
+}
+
+int main()
+{
+    // Known sequence: GPIO 5 high, delay 10 us, SPI byte 0xa5 at 8 MHz for 1 us, GPIO 5 low
+    hV_HAL_SPI_begin(8000000);
+    hV_HAL_Trace_clear();
+
+    uint32_t start = micros();
+    hV_HAL_GPIO_write(5, HIGH);
+    hV_HAL_delayMicroseconds(10);
+    hV_HAL_SPI_transfer(0xa5);
+    hV_HAL_GPIO_write(5, LOW);
+
+    // Dump and load
+    FILE * file = fopen("trace_test.txt", "w");
+    uint32_t saved = hV_HAL_Trace_save(file);
+    fclose(file);
+
+    std::vector<traceRecord_t> records;
+    file = fopen("trace_test.txt", "r");
+    uint32_t loaded = hV_HAL_Trace_load(file, records);
+    fclose(file);
+
+    h_check((saved == 4) and (loaded == 4), "Dump saved and loaded, 4 records");
+
+    traceRecord_t copied[4];
+    bool flagSame = (hV_HAL_Trace_copy(copied, 4) == 4) and (loaded == 4);
+    for (uint8_t index = 0; flagSame and (index < 4); index++)
+    {
+        flagSame = (records[index].time == copied[index].time) and (records[index].value == copied[index].value) and (records[index].type == copied[index].type) and (records[index].id == copied[index].id);
+    }
+    h_check(flagSame, "Loaded records identical to recorded records");
+
+    h_check((loaded == 4) and (records[0].type == TRACE_GPIO_WRITE) and (records[1].type == TRACE_DELAY) and (records[2].type == TRACE_SPI_BYTE) and (records[3].type == TRACE_GPIO_WRITE), "Types in order GPIO, delay, SPI, GPIO");
+    h_check((loaded == 4) and (records[3].time == start + 11), "Time stamps on the simulated clock");
+
+    // Console output before the header ignored
+    std::string dump = h_readFile("trace_test.txt");
+    file = fopen("trace_noise.txt", "w");
+    fprintf(file, "hV . Console output\n%s", dump.c_str());
+    fclose(file);
+    file = fopen("trace_noise.txt", "r");
+    std::vector<traceRecord_t> noise;
+    h_check(hV_HAL_Trace_load(file, noise) == 4, "Console output before the header ignored");
+    fclose(file);
+
+    // VCD
+    file = fopen("trace_test.vcd", "w");
+    hV_HAL_Trace_exportVCD(file, records.data(), records.size());
+    fclose(file);
+    std::string vcd = h_readFile("trace_test.vcd");
+
+    h_check(h_contains(vcd, "$var wire 1 &! gpio_%lu $end", 5), "VCD GPIO 5 declared");
+    h_check(h_contains(vcd, "#%lu\n1&!\n1o#\n", start), "VCD GPIO 5 high and delay start");
+    h_check(h_contains(vcd, "#%lu\n0o#\nb10100101 m#\n", start + 10), "VCD delay end and SPI byte 0xa5");
+    h_check(h_contains(vcd, "#%lu\n0&!\n", start + 11), "VCD GPIO 5 low after the SPI byte");
+
+    // Chrome JSON
+    file = fopen("trace_test.json", "w");
+    hV_HAL_Trace_exportChrome(file, records.data(), records.size());
+    fclose(file);
+    std::string json = h_readFile("trace_test.json");
+
+    h_check(h_contains(json, "{\"name\":\"Delay\",\"ph\":\"X\",\"ts\":%lu,\"dur\":10,", start), "Chrome delay of 10 us");
+    h_check(h_contains(json, "{\"name\":\"SPI byte\",\"ph\":\"i\",\"s\":\"t\",\"ts\":%lu,\"pid\":1,\"tid\":2,\"args\":{\"value\":165}}", start + 10), "Chrome SPI byte 0xa5");
+    h_check(h_contains(json, "{\"name\":\"GPIO 5\",\"ph\":\"C\",\"ts\":%lu,\"pid\":1,\"tid\":1,\"args\":{\"level\":0}}", start + 11), "Chrome GPIO 5 low");
+    h_check((json.compare(0, 15, "{\"traceEvents\":") == 0) and (json.find("\n]}\n") != std::string::npos), "Chrome JSON enclosed");
+
+    printf("%i failure(s)\n", h_failures);
+    return (h_failures == 0) ? 0 : 1;
+}
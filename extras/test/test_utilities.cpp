@@ -0,0 +1,176 @@
+//
+// test_utilities.cpp
+// Test C++ code
+// ----------------------------------
+//
+// Details Checks of the frame comparison and UTF-8 conversion on the host back-end
+// Project Pervasive Displays Library Suite
+// Based on highView technology
+//
+// Created by Rei Vilo, 17 Oct 2026
+//
+// Copyright (c) Pervasive Displays Inc., 2021-2025
+// Copyright (c) Etigues, 2010-2025
+// Licence All rights reserved
+// For exclusive use with Pervasive Displays screens
+//
+// Release 1000: Initial release
+//
+
+// Utilities
+#include "hV_Utilities.h"
+
+#include <stdio.h>
+
+#if !defined(hV_HAL_HOST)
+#error Host back-end required
+#endif // hV_HAL_HOST
+
+static uint16_t h_failures = 0;
+
+///
+/// @brief Check a condition
+/// @param condition condition, true = pass
+/// @param text description
+///
+static void h_check(bool condition, const char * text)
+{
+    printf("%s %s\n", condition ? "PASS" : "FAIL", text);
+    if (condition == false)
+    {
+        h_failures += 1;
+    }
+}
+
+///
+/// @brief Size of the largest frame plane, 9.69" = 184 KB
+///
+#define FRAME_SIZE (184 * 1024)
+
+static uint8_t h_frame1[FRAME_SIZE];
+static uint8_t h_frame2[FRAME_SIZE];
+
+///
+/// @brief Check the result of diffFrames()
+/// @param diff result
+/// @param count expected number of bytes changed
+/// @param rowFirst expected first row
+/// @param rowLast expected last row
+/// @param columnFirst expected first column
+/// @param columnLast expected last column
+/// @return true if as expected
+///
+static bool h_isDiff(const frameDiff_t & diff, uint32_t count, uint32_t rowFirst, uint32_t rowLast, uint32_t columnFirst, uint32_t columnLast)
+{
+    return (diff.count == count) and (diff.rowFirst == rowFirst) and (diff.rowLast == rowLast) and (diff.columnFirst == columnFirst) and (diff.columnLast == columnLast);
+}
+
+///
+/// @brief Restore the second frame
+///
+static void h_restore()
+{
+    memcpy(h_frame2, h_frame1, FRAME_SIZE);
+}
+
+static void h_testIdentical()
+{
+    frameDiff_t diff;
+    h_check((diffFrames(h_frame1, h_frame2, FRAME_SIZE, 33, diff) == 0) and h_isDiff(diff, 0, 0, 0, 0, 0), "Identical frames, empty result");
+    h_check((diffFrames(h_frame1, h_frame2, FRAME_SIZE, 0, diff) == 0) and h_isDiff(diff, 0, 0, 0, 0, 0), "Identical frames, whole frame as one row");
+}
+
+static void h_testFirstLast()
+{
+    frameDiff_t diff;
+
+    h_frame2[0] ^= 0x01;
+    h_check((diffFrames(h_frame1, h_frame2, 5808, 33, diff) == 1) and h_isDiff(diff, 1, 0, 0, 0, 0), "Single byte changed in the first word");
+    h_restore();
+
+    h_frame2[5807] ^= 0x80;
+    h_check((diffFrames(h_frame1, h_frame2, 5808, 33, diff) == 1) and h_isDiff(diff, 1, 175, 175, 32, 32), "Single byte changed in the last word");
+    h_restore();
+
+    // Word changed, bytes on either side unchanged
+    h_frame2[3] ^= 0xff;
+    h_check((diffFrames(h_frame1, h_frame2, 64, 0, diff) == 1) and h_isDiff(diff, 1, 0, 0, 3, 3), "Single byte changed within a word");
+    h_restore();
+}
+
+static void h_testTail()
+{
+    frameDiff_t diff;
+
+    // 13 bytes, tail shorter than a word
+    h_frame2[12] ^= 0x10;
+    h_check((diffFrames(h_frame1, h_frame2, 13, 0, diff) == 1) and h_isDiff(diff, 1, 0, 0, 12, 12), "Change in the unaligned tail");
+
+    // Byte after the frame ignored
+    h_frame2[12] = h_frame1[12];
+    h_frame2[13] ^= 0x10;
+    h_check(diffFrames(h_frame1, h_frame2, 13, 0, diff) == 0, "Byte after the unaligned tail ignored");
+    h_restore();
+
+    // Rows with unaligned start, change in the tail of each row
+    h_frame2[1 + 1 * 11 + 10] ^= 0x01;
+    h_frame2[1 + 3 * 11 + 9] ^= 0x01;
+    h_check((diffFrames(h_frame1 + 1, h_frame2 + 1, 5 * 11, 11, diff) == 2) and h_isDiff(diff, 2, 1, 3, 9, 10), "Changes in the tails of unaligned rows");
+    h_restore();
+}
+
+static void h_testWindow()
+{
+    frameDiff_t diff;
+
+    // Stride 8, changes at row 2 column 1, row 5 column 6, row 3 column 3
+    h_frame2[2 * 8 + 1] ^= 0x01;
+    h_frame2[5 * 8 + 6] ^= 0x01;
+    h_frame2[3 * 8 + 3] ^= 0x01;
+    h_check((diffFrames(h_frame1, h_frame2, 10 * 8, 8, diff) == 3) and h_isDiff(diff, 3, 2, 5, 1, 6), "Bounding box over several rows");
+    h_restore();
+}
+
+static void h_testLarge()
+{
+    frameDiff_t diff;
+
+    // Stride 1 on 184 KB, more than 65535 rows
+    h_frame2[100000] ^= 0x01;
+    h_frame2[FRAME_SIZE - 1] ^= 0x01;
+    h_check((diffFrames(h_frame1, h_frame2, FRAME_SIZE, 1, diff) == 2) and h_isDiff(diff, 2, 100000, FRAME_SIZE - 1, 0, 0), "Rows beyond 65535 with stride 1");
+    h_restore();
+
+    // Stride 2 on 161 KB
+    h_frame2[150001] ^= 0x01;
+    h_check((diffFrames(h_frame1, h_frame2, 161 * 1024, 2, diff) == 1) and h_isDiff(diff, 1, 75000, 75000, 1, 1), "Rows beyond 65535 with stride 2");
+    h_restore();
+}
+
+static void h_testUTF16()
+{
+    uint16_t text[16];
+
+    // "a€b", euro sign mapped to the Font_Terminal code
+    h_check((utf8to16("a\xe2\x82\xac" "b", text) == 3) and (text[0] == 'a') and (text[1] == 0x80) and (text[2] == 'b') and (text[3] == 0x0000), "UTF-8 converted without limit");
+    h_check((utf8to16("abcdef", text, 4) == 4) and (text[3] == 'd') and (text[4] == 0x0000), "UTF-8 converted up to the limit");
+}
+
+int main()
+{
+    for (uint32_t index = 0; index < FRAME_SIZE; index++)
+    {
+        h_frame1[index] = (uint8_t)(index * 7 + 3);
+    }
+    h_restore();
+
+    h_testIdentical();
+    h_testFirstLast();
+    h_testTail();
+    h_testWindow();
+    h_testLarge();
+    h_testUTF16();
+
+    printf("%i failure(s)\n", h_failures);
+    return (h_failures == 0) ? 0 : 1;
+}
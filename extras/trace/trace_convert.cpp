@@ -0,0 +1,75 @@
+//
+// trace_convert.cpp
+// Tool C++ code
+// ----------------------------------
+//
+// Details Conversion of a bus trace dump to VCD and Chrome trace JSON
+// Project Pervasive Displays Library Suite
+// Based on highView technology
+//
+// Created by Rei Vilo, 17 Oct 2026
+//
+// Copyright (c) Pervasive Displays Inc., 2021-2025
+// Copyright (c) Etigues, 2010-2025
+// Licence All rights reserved
+// For exclusive use with Pervasive Displays screens
+//
+// Release 1000: Initial release
+//
+// Usage: trace_convert dump.txt trace.vcd trace.json
+// Dump captured from the serial console after hV_HAL_Trace_dump()
+// or saved on the host by hV_HAL_Trace_save()
+//
+
+// Peripherals
+#include "hV_HAL_Peripherals.h"
+
+#if !defined(hV_HAL_HOST)
+#error Host back-end required
+#endif // hV_HAL_HOST
+
+int main(int argc, char * argv[])
+{
+    if (argc != 4)
+    {
+        fprintf(stderr, "Usage: %s dump.txt trace.vcd trace.json\n", argv[0]);
+        return 1;
+    }
+
+    FILE * file = fopen(argv[1], "r");
+    if (file == 0)
+    {
+        fprintf(stderr, "Cannot open %s\n", argv[1]);
+        return 1;
+    }
+
+    std::vector<traceRecord_t> records;
+    uint32_t number = hV_HAL_Trace_load(file, records);
+    fclose(file);
+    if (number == 0)
+    {
+        fprintf(stderr, "No records in %s\n", argv[1]);
+        return 1;
+    }
+
+    file = fopen(argv[2], "w");
+    if (file == 0)
+    {
+        fprintf(stderr, "Cannot open %s\n", argv[2]);
+        return 1;
+    }
+    hV_HAL_Trace_exportVCD(file, records.data(), number);
+    fclose(file);
+
+    file = fopen(argv[3], "w");
+    if (file == 0)
+    {
+        fprintf(stderr, "Cannot open %s\n", argv[3]);
+        return 1;
+    }
+    hV_HAL_Trace_exportChrome(file, records.data(), number);
+    fclose(file);
+
+    printf("%u records converted to %s and %s\n", number, argv[2], argv[3]);
+    return 0;
+}
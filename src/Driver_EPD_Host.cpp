@@ -0,0 +1,482 @@
+//
+// Driver_EPD_Host.cpp
+// Class library C++ code
+// ----------------------------------
+//
+// Project Pervasive Displays Library Suite
+// Based on highView technology
+//
+// Created by Rei Vilo, 17 Oct 2026
+//
+// @copyright (c) Pervasive Displays Inc., 2021-2025
+// Copyright (c) Etigues, 2010-2025
+// Licence All rights reserved
+// For exclusive use with Pervasive Displays screens
+//
+// Release 1000: Initial release
+// Release 1001: Added asynchronous updates
+// Release 1002: Added update parameters per temperature band
+//
+
+#include "Driver_EPD_Host.h"
+
+#if defined(hV_HAL_HOST)
+
+///
+/// @brief Geometry of a screen
+/// @note Frame plane = height rows of width / 8 bytes, or width / 4 bytes for BWRY
+///
+struct h_geometry_t
+{
+    uint16_t size; ///< SIZE_150 to SIZE_1198
+    uint16_t width; ///< pixels per row
+    uint16_t height; ///< rows
+    uint8_t family; ///< FAMILY_SMALL to FAMILY_LARGE
+};
+
+static const h_geometry_t h_geometry[] =
+{
+    { SIZE_150, 200, 200, FAMILY_SMALL },
+    { SIZE_152, 200, 200, FAMILY_SMALL },
+    { SIZE_154, 152, 152, FAMILY_SMALL },
+    { SIZE_206, 128, 248, FAMILY_SMALL },
+    { SIZE_213, 104, 212, FAMILY_SMALL },
+    { SIZE_266, 152, 296, FAMILY_SMALL },
+    { SIZE_271, 176, 264, FAMILY_SMALL },
+    { SIZE_287, 128, 296, FAMILY_SMALL },
+    { SIZE_290, 168, 384, FAMILY_SMALL },
+    { SIZE_340, 392, 228, FAMILY_MEDIUM },
+    { SIZE_343, 392, 228, FAMILY_MEDIUM },
+    { SIZE_350, 240, 416, FAMILY_MEDIUM },
+    { SIZE_370, 240, 416, FAMILY_MEDIUM },
+    { SIZE_417, 300, 400, FAMILY_MEDIUM },
+    { SIZE_437, 176, 480, FAMILY_MEDIUM },
+    { SIZE_565, 600, 448, FAMILY_MEDIUM },
+    { SIZE_581, 256, 720, FAMILY_MEDIUM },
+    { SIZE_741, 480, 800, FAMILY_MEDIUM },
+    { SIZE_969, 672, 960, FAMILY_LARGE },
+    { SIZE_1198, 768, 960, FAMILY_LARGE },
+    { SIZE_NONE, 0, 0, FAMILY_SMALL }
+};
+
+///
+/// @brief Modelled refresh durations of a film
+/// @note Index = family - 1, values in ms
+/// @note Fast = normal for films without embedded fast update
+///
+struct h_duration_t
+{
+    uint8_t film; ///< FILM_C to FILM_T
+    uint16_t normal[3]; ///< normal update, ms
+    uint16_t fast[3]; ///< fast update, ms
+};
+
+static const h_duration_t h_duration[] =
+{
+    { FILM_E, { 15000, 18000, 25000 }, { 15000, 18000, 25000 } },
+    { FILM_F, { 15000, 18000, 25000 }, { 15000, 18000, 25000 } },
+    { FILM_G, { 15000, 18000, 25000 }, { 15000, 18000, 25000 } },
+    { FILM_J, { 15000, 18000, 25000 }, { 15000, 18000, 25000 } },
+    { FILM_Q, { 15000, 20000, 25000 }, { 15000, 20000, 25000 } },
+    { FILM_P, { 1500, 2000, 3000 }, { 300, 400, 550 } },
+    { FILM_K, { 1800, 2500, 3500 }, { 450, 550, 750 } },
+    { FILM_T, { 1800, 2500, 3500 }, { 450, 550, 750 } },
+    { FILM_NONE, { 1800, 3500, 4500 }, { 1800, 3500, 4500 } } // FILM_C and FILM_H
+};
+
+Driver_EPD_Host::Driver_EPD_Host(eScreen_EPD_t eScreen_EPD, pins_t board)
+    : Driver_EPD_Virtual(eScreen_EPD, board)
+{
+    ;
+}
+
+void Driver_EPD_Host::begin()
+{
+    uint8_t index = 0;
+    while ((h_geometry[index].size != SIZE_NONE) and (h_geometry[index].size != SCREEN_SIZE(u_eScreen_EPD)))
+    {
+        index++;
+    }
+    _width = h_geometry[index].width;
+    _height = h_geometry[index].height;
+    uint8_t family = h_geometry[index].family;
+
+    index = 0;
+    while ((h_duration[index].film != FILM_NONE) and (h_duration[index].film != SCREEN_FILM(u_eScreen_EPD)))
+    {
+        index++;
+    }
+    _durationNormal = h_duration[index].normal[family - 1];
+    _durationFast = h_duration[index].fast[family - 1];
+
+    d_COG = COG(SCREEN_FILM(u_eScreen_EPD), family);
+    b_resetCOG = d_COG; // For SEQUENCE_RESET
+
+    b_begin(b_pin, family, 50);
+    b_resume();
+    hV_HAL_SPI_begin();
+
+    clearStatistics();
+}
+
+STRING_CONST_TYPE Driver_EPD_Host::reference()
+{
+    return formatString("Host simulator v%i.%i.%i", DRIVER_EPD_HOST_RELEASE / 100, (DRIVER_EPD_HOST_RELEASE / 10) % 10, DRIVER_EPD_HOST_RELEASE % 10);
+}
+
+void Driver_EPD_Host::updateNormal(FRAMEBUFFER_CONST_TYPE frame,
+                                   uint32_t size)
+{
+    _plane[0] = frame;
+    _plane[1] = 0;
+    _plane[2] = 0;
+    _plane[3] = 0;
+    _size = size;
+
+    _update(_durationNormal, false);
+}
+
+void Driver_EPD_Host::updateNormal(FRAMEBUFFER_CONST_TYPE frame1, FRAMEBUFFER_CONST_TYPE frame2,
+                                   uint32_t size)
+{
+    if (b_family == FAMILY_LARGE)
+    {
+        // Master and slave
+        _plane[0] = frame1;
+        _plane[1] = 0;
+        _plane[2] = frame2;
+        _plane[3] = 0;
+    }
+    else
+    {
+        // Black and red
+        _plane[0] = frame1;
+        _plane[1] = frame2;
+        _plane[2] = 0;
+        _plane[3] = 0;
+    }
+    _size = size;
+
+    _update(_durationNormal, false);
+}
+
+void Driver_EPD_Host::updateNormal(FRAMEBUFFER_CONST_TYPE frameM1, FRAMEBUFFER_CONST_TYPE frameM2,
+                                   FRAMEBUFFER_CONST_TYPE frameS1, FRAMEBUFFER_CONST_TYPE frameS2,
+                                   uint32_t size)
+{
+    _plane[0] = frameM1;
+    _plane[1] = frameM2;
+    _plane[2] = frameS1;
+    _plane[3] = frameS2;
+    _size = size;
+
+    _update(_durationNormal, false);
+}
+
+void Driver_EPD_Host::updateFast(FRAMEBUFFER_CONST_TYPE frame1, FRAMEBUFFER_CONST_TYPE frame2,
+                                 uint32_t size)
+{
+    // Next and previous
+    _plane[0] = frame1;
+    _plane[1] = frame2;
+    _plane[2] = 0;
+    _plane[3] = 0;
+    _size = size;
+
+    _update(_durationFast, true);
+}
+
+void Driver_EPD_Host::updateFast(FRAMEBUFFER_CONST_TYPE frameM1, FRAMEBUFFER_CONST_TYPE frameM2,
+                                 FRAMEBUFFER_CONST_TYPE frameS1, FRAMEBUFFER_CONST_TYPE frameS2,
+                                 uint32_t size)
+{
+    _plane[0] = frameM1;
+    _plane[1] = frameM2;
+    _plane[2] = frameS1;
+    _plane[3] = frameS2;
+    _size = size;
+
+    _update(_durationFast, true);
+}
+
+Driver_EPD_Handle Driver_EPD_Host::updateNormalAsync(FRAMEBUFFER_CONST_TYPE frame,
+                                                   uint32_t size)
+{
+    _plane[0] = frame;
+    _plane[1] = 0;
+    _plane[2] = 0;
+    _plane[3] = 0;
+    _size = size;
+
+    return _updateAsync(_durationNormal, false);
+}
+
+Driver_EPD_Handle Driver_EPD_Host::updateFastAsync(FRAMEBUFFER_CONST_TYPE frame1, FRAMEBUFFER_CONST_TYPE frame2,
+                                                 uint32_t size)
+{
+    _plane[0] = frame1;
+    _plane[1] = frame2;
+    _plane[2] = 0;
+    _plane[3] = 0;
+    _size = size;
+
+    return _updateAsync(_durationFast, true);
+}
+
+void Driver_EPD_Host::setSnapshot(const char * prefix)
+{
+    _prefix = (prefix != 0) ? prefix : "";
+    _snapshotNumber = 0;
+}
+
+void Driver_EPD_Host::setUpdateDuration(uint32_t normal, uint32_t fast)
+{
+    _durationNormal = normal;
+    _durationFast = fast;
+}
+
+hostUpdate_t Driver_EPD_Host::getStatistics()
+{
+    return _statistics;
+}
+
+void Driver_EPD_Host::clearStatistics()
+{
+    _statistics = {};
+}
+
+uint16_t Driver_EPD_Host::getWidth()
+{
+    return _width;
+}
+
+uint16_t Driver_EPD_Host::getHeight()
+{
+    return _height;
+}
+
+void Driver_EPD_Host::d_computeParameters(int8_t temperatureC, updateParameters_t & parameters)
+{
+    // Lowest temperature of the band
+    int8_t lowest = TEMPERATURE_BAND_MINIMUM + d_getTemperatureBand(temperatureC) * TEMPERATURE_BAND_WIDTH;
+
+    // Films with embedded fast update
+    uint8_t film = COG_FILM(d_COG);
+    bool flagEmbedded = (film == FILM_P) or (film == FILM_K) or (film == FILM_T);
+
+    parameters.data[HOST_PARAMETER_TEMPERATURE] = (uint8_t)lowest;
+    parameters.data[HOST_PARAMETER_TEMPERATURE_FAST] = (uint8_t)(flagEmbedded ? lowest + 0x40 : lowest);
+
+    // Slower refresh at low temperature
+    if (lowest < 0)
+    {
+        parameters.data[HOST_PARAMETER_DURATION] = 250;
+    }
+    else if (lowest < 10)
+    {
+        parameters.data[HOST_PARAMETER_DURATION] = 200;
+    }
+    else if (lowest < 20)
+    {
+        parameters.data[HOST_PARAMETER_DURATION] = 150;
+    }
+    else
+    {
+        parameters.data[HOST_PARAMETER_DURATION] = 100;
+    }
+    parameters.length = HOST_PARAMETER_NUMBER;
+}
+
+void Driver_EPD_Host::_send(bool flagFast)
+{
+    u_waitAsync(); // Previous asynchronous update
+
+    _flagFast = flagFast;
+    _chrono = hV_HAL_Host_getMicroseconds();
+    uint32_t bytes = hV_HAL_Host_getCounters().spiByte;
+
+    // Reset
+    b_reset(d_COG);
+    uint64_t chronoReset = hV_HAL_Host_getMicroseconds();
+
+    // Temperature, from the cache of the band
+    const updateParameters_t & parameters = u_getParameters();
+    b_sendCommandData8(0xe5, parameters.data[flagFast ? HOST_PARAMETER_TEMPERATURE_FAST : HOST_PARAMETER_TEMPERATURE]);
+
+    // Frame planes
+    if (b_family == FAMILY_LARGE)
+    {
+        for (uint8_t half = 0; half < 2; half++)
+        {
+            uint8_t select = (half == 0) ? PANEL_CS_MASTER : PANEL_CS_SLAVE;
+            if (_plane[half * 2] != 0)
+            {
+                b_sendIndexDataSelect(0x10, _plane[half * 2], _size, select);
+            }
+            if (_plane[half * 2 + 1] != 0)
+            {
+                b_sendIndexDataSelect(0x13, _plane[half * 2 + 1], _size, select);
+            }
+        }
+    }
+    else
+    {
+        b_sendIndexData(0x10, _plane[0], _size);
+        if (_plane[1] != 0)
+        {
+            b_sendIndexData(0x13, _plane[1], _size);
+        }
+    }
+    b_sendCommand8(0x12); // Display refresh
+    uint64_t chronoBus = hV_HAL_Host_getMicroseconds();
+
+    if (flagFast)
+    {
+        _statistics.fast++;
+    }
+    else
+    {
+        _statistics.normal++;
+    }
+    _statistics.bytes += hV_HAL_Host_getCounters().spiByte - bytes;
+    _statistics.reset += chronoReset - _chrono;
+    _statistics.bus += chronoBus - chronoReset;
+
+    if ((_prefix.length() > 0) and (_width > 0))
+    {
+        _snapshot();
+    }
+}
+
+void Driver_EPD_Host::_update(uint32_t duration, bool flagFast)
+{
+    _send(flagFast);
+    uint64_t chronoBus = hV_HAL_Host_getMicroseconds();
+    duration = duration * u_getParameters().data[HOST_PARAMETER_DURATION] / 100;
+
+    // Refresh
+    hV_HAL_delayMilliseconds(duration);
+    b_sendCommand8(0x02); // Turn off DC/DC
+    uint64_t chronoEnd = hV_HAL_Host_getMicroseconds();
+
+    _statistics.refresh += chronoEnd - chronoBus;
+    _statistics.last = chronoEnd - _chrono;
+}
+
+Driver_EPD_Handle Driver_EPD_Host::_updateAsync(uint32_t duration, bool flagFast)
+{
+    _send(flagFast);
+
+    // Refresh as a non-blocking sequence
+    duration = duration * u_getParameters().data[HOST_PARAMETER_DURATION] / 100;
+    duration = hV_HAL_min(duration, (uint32_t)0xffff);
+    uint8_t sequence[] =
+    {
+        SEQUENCE_PHASE(UPDATE_PHASE_REFRESH),
+        SEQUENCE_DELAY(duration),
+        SEQUENCE_PHASE(UPDATE_PHASE_STOP),
+        SEQUENCE_INDEX(0x02), // Turn off DC/DC
+        SEQUENCE_END
+    };
+    memcpy(_sequence, sequence, sizeof(sequence));
+
+    _statistics.refresh += (uint64_t)duration * 1000;
+    _statistics.last = hV_HAL_Host_getMicroseconds() - _chrono + (uint64_t)duration * 1000;
+
+    return u_startAsync(_sequence);
+}
+
+uint8_t Driver_EPD_Host::_getColour(uint16_t x, uint16_t y)
+{
+    // BWRY, 2 bits per pixel
+    if (SCREEN_FILM(u_eScreen_EPD) == FILM_Q)
+    {
+        uint32_t index = (uint32_t)y * (_width / 4) + x / 4;
+        if (index >= _size)
+        {
+            return HOST_COLOUR_WHITE;
+        }
+
+        static const uint8_t colours[4] = { HOST_COLOUR_BLACK, HOST_COLOUR_WHITE, HOST_COLOUR_YELLOW, HOST_COLOUR_RED };
+        return colours[(_plane[0][index] >> (6 - 2 * (x % 4))) & 0x03];
+    }
+
+    // Black and red, master then slave for large screens
+    uint8_t half = 0;
+    uint16_t bytesRow = _width / 8;
+    if (b_family == FAMILY_LARGE)
+    {
+        bytesRow = _width / 16;
+        if (x >= _width / 2)
+        {
+            half = 2;
+            x -= _width / 2;
+        }
+    }
+
+    uint32_t index = (uint32_t)y * bytesRow + x / 8;
+    uint8_t mask = 0x80 >> (x % 8);
+    if ((index >= _size) or (_plane[half] == 0))
+    {
+        return HOST_COLOUR_WHITE;
+    }
+
+    // Fast update: second plane is the previous image
+    if ((not _flagFast) and (_plane[half + 1] != 0) and ((_plane[half + 1][index] & mask) != 0))
+    {
+        return HOST_COLOUR_RED;
+    }
+    return ((_plane[half][index] & mask) != 0) ? HOST_COLOUR_BLACK : HOST_COLOUR_WHITE;
+}
+
+void Driver_EPD_Host::_snapshot()
+{
+    bool flagColour = (SCREEN_FILM(u_eScreen_EPD) == FILM_Q) or ((not _flagFast) and ((_plane[1] != 0) or (_plane[3] != 0)));
+
+    char name[256];
+    snprintf(name, sizeof(name), "%s_%04u.%s", _prefix.c_str(), (unsigned int)_snapshotNumber, flagColour ? "ppm" : "pbm");
+    _snapshotNumber++;
+
+    FILE * file = fopen(name, "wb");
+    if (file == 0)
+    {
+        return;
+    }
+
+    if (flagColour)
+    {
+        // PPM, 8 bits per channel
+        static const uint8_t rgb[4][3] = { { 0xff, 0xff, 0xff }, { 0x00, 0x00, 0x00 }, { 0xff, 0x00, 0x00 }, { 0xff, 0xff, 0x00 } };
+
+        fprintf(file, "P6\n%u %u\n255\n", _width, _height);
+        for (uint16_t y = 0; y < _height; y++)
+        {
+            for (uint16_t x = 0; x < _width; x++)
+            {
+                fwrite(rgb[_getColour(x, y)], 1, 3, file);
+            }
+        }
+    }
+    else
+    {
+        // PBM, 1 bit per pixel, 1 = black
+        fprintf(file, "P4\n%u %u\n", _width, _height);
+        std::vector<uint8_t> row((_width + 7) / 8);
+        for (uint16_t y = 0; y < _height; y++)
+        {
+            memset(row.data(), 0x00, row.size());
+            for (uint16_t x = 0; x < _width; x++)
+            {
+                if (_getColour(x, y) == HOST_COLOUR_BLACK)
+                {
+                    row[x / 8] |= 0x80 >> (x % 8);
+                }
+            }
+            fwrite(row.data(), 1, row.size(), file);
+        }
+    }
+
+    fclose(file);
+}
+
+#endif // hV_HAL_HOST
@@ -0,0 +1,306 @@
+///
+/// @file Driver_EPD_Host.h
+/// @brief Simulator driver on the host back-end - Basic edition
+///
+/// @details Project Pervasive Displays Library Suite
+/// @n Based on highView technology
+/// @n Decodes the frame planes into snapshots and models the update durations
+/// * Bus time measured on the simulated clock of the host back-end
+/// * Update duration modelled per COG, film and family
+/// * Snapshots as PBM for black-white screens, PPM for colour screens
+///
+/// @date 17 Oct 2026
+/// @version 1000
+///
+/// @copyright (c) Pervasive Displays Inc., 2021-2025
+/// @copyright (c) Etigues, 2010-2025
+/// @copyright All rights reserved
+/// @copyright For exclusive use with Pervasive Displays screens
+///
+/// * Basic edition: for hobbyists and for basic usage
+/// @n Creative Commons Attribution-ShareAlike 4.0 International (CC BY-SA 4.0)
+/// @see https://creativecommons.org/licenses/by-sa/4.0/
+///
+/// @n Consider the Evaluation or Commercial editions for professionals or organisations and for commercial usage
+///
+/// * Evaluation edition: for professionals or organisations, evaluation only, no commercial usage
+/// @n All rights reserved
+///
+/// * Commercial edition: for professionals or organisations, commercial usage
+/// @n All rights reserved
+///
+/// * Viewer edition: for professionals or organisations
+/// @n All rights reserved
+///
+/// * Documentation
+/// @n All rights reserved
+///
+/// @note Host back-end only
+/// @code {.cpp}
+/// Driver_EPD_Host driver(SCREEN(SIZE_271, FILM_K, DRIVER_NONE), boardRaspberryPiPico_RP2040);
+///
+/// driver.begin();
+/// driver.setSnapshot("/tmp/snapshot");
+/// driver.updateFast(frameNext, framePrevious, frameSize_EPD_271 / 2);
+///
+/// hostUpdate_t statistics = driver.getStatistics();
+/// @endcode
+///
+
+// Driver
+#include "Driver_EPD_Virtual.h"
+
+#if (DRIVER_EPD_VIRTUAL_RELEASE < 1000)
+#error Required DRIVER_EPD_VIRTUAL_RELEASE 1000
+#endif // DRIVER_EPD_VIRTUAL_RELEASE
+
+#ifndef DRIVER_EPD_HOST_RELEASE
+///
+/// @brief Library release number
+///
+#define DRIVER_EPD_HOST_RELEASE 1002
+
+#if defined(hV_HAL_HOST)
+
+///
+/// @name Colours of the snapshot pixels
+/// @note Numbers are sequential and exclusive
+/// @{
+#define HOST_COLOUR_WHITE 0x00 ///< White
+#define HOST_COLOUR_BLACK 0x01 ///< Black
+#define HOST_COLOUR_RED 0x02 ///< Red
+#define HOST_COLOUR_YELLOW 0x03 ///< Yellow
+/// @}
+
+///
+/// @name Update parameters of the simulator
+/// @note Index in updateParameters_t.data, computed per temperature band
+/// @{
+#define HOST_PARAMETER_TEMPERATURE 0 ///< temperature sent to register 0xe5, normal update
+#define HOST_PARAMETER_TEMPERATURE_FAST 1 ///< temperature sent to register 0xe5, fast update
+#define HOST_PARAMETER_DURATION 2 ///< refresh duration, % of the duration at 20 °C and above
+#define HOST_PARAMETER_NUMBER 3 ///< Number of parameters
+/// @}
+
+///
+/// @brief Statistics of the simulated updates
+/// @note All times in us, on the simulated clock
+///
+struct hostUpdate_t
+{
+    uint32_t normal; ///< number of normal updates
+    uint32_t fast; ///< number of fast updates
+    uint32_t bytes; ///< number of bytes sent on SPI
+    uint64_t reset; ///< total of reset time
+    uint64_t bus; ///< total of bus time, frame planes and commands
+    uint64_t refresh; ///< total of modelled refresh time
+    uint64_t last; ///< time of the last update, from reset to end of refresh
+};
+
+///
+/// @brief Simulator driver class
+/// @details Concrete driver for the host back-end
+/// * Reset with the profile of the COG
+/// * Temperature sent to register 0xe5, from the update parameters of the band
+/// * Frame planes sent through hV_Board, with the SPI clock and timing profile
+/// * Refresh modelled by a delay on the simulated clock, longer at low temperature
+///
+class Driver_EPD_Host: public Driver_EPD_Virtual
+{
+  public:
+
+    ///
+    /// @brief Constructor
+    /// @param eScreen_EPD screen, size and film used
+    /// @param board board, pins used for the simulated bus
+    ///
+    Driver_EPD_Host(eScreen_EPD_t eScreen_EPD, pins_t board);
+
+    ///
+    /// @brief Initialisation
+    /// @note Family and geometry from the size of the screen
+    ///
+    void begin();
+
+    ///
+    /// @brief Driver reference
+    /// @return STRING_CONST_TYPE scope and release number
+    ///
+    STRING_CONST_TYPE reference();
+
+    ///
+    /// @brief Normal update, black-white or BWRY
+    /// @param frame next image
+    /// @param sizeFrame size of the frame
+    ///
+    void updateNormal(FRAMEBUFFER_CONST_TYPE frame,
+                      uint32_t sizeFrame);
+
+    ///
+    /// @brief Normal update, black and red, or master and slave for large screens
+    /// @param frame1 next image, black or master
+    /// @param frame2 next image, red or slave
+    /// @param sizeFrame size of the frame
+    ///
+    void updateNormal(FRAMEBUFFER_CONST_TYPE frame1, FRAMEBUFFER_CONST_TYPE frame2,
+                      uint32_t sizeFrame);
+
+    ///
+    /// @brief Normal update, black and red for large screens
+    /// @param frameM1 next image, black, master
+    /// @param frameM2 next image, red, master
+    /// @param frameS1 next image, black, slave
+    /// @param frameS2 next image, red, slave
+    /// @param sizeFrame size of the frame
+    ///
+    void updateNormal(FRAMEBUFFER_CONST_TYPE frameM1, FRAMEBUFFER_CONST_TYPE frameM2,
+                      FRAMEBUFFER_CONST_TYPE frameS1, FRAMEBUFFER_CONST_TYPE frameS2,
+                      uint32_t sizeFrame);
+
+    using Driver_EPD_Virtual::updateFast;
+
+    ///
+    /// @brief Fast update
+    /// @param frame1 next image
+    /// @param frame2 previous image
+    /// @param sizeFrame size of the frame
+    ///
+    void updateFast(FRAMEBUFFER_CONST_TYPE frame1, FRAMEBUFFER_CONST_TYPE frame2,
+                    uint32_t sizeFrame);
+
+    ///
+    /// @brief Fast update for large screens
+    /// @param frameM1 next image, master
+    /// @param frameM2 previous image, master
+    /// @param frameS1 next image, slave
+    /// @param frameS2 previous image, slave
+    /// @param sizeFrame size of the frame
+    ///
+    void updateFast(FRAMEBUFFER_CONST_TYPE frameM1, FRAMEBUFFER_CONST_TYPE frameM2,
+                    FRAMEBUFFER_CONST_TYPE frameS1, FRAMEBUFFER_CONST_TYPE frameS2,
+                    uint32_t sizeFrame);
+
+    ///
+    /// @brief Asynchronous normal update
+    /// @param frame next image
+    /// @param sizeFrame size of the frame
+    /// @return completion handle
+    /// @note Frame sent, then refresh modelled by a non-blocking delay
+    ///
+    Driver_EPD_Handle updateNormalAsync(FRAMEBUFFER_CONST_TYPE frame,
+                                        uint32_t sizeFrame);
+
+    ///
+    /// @brief Asynchronous fast update
+    /// @param frame1 next image
+    /// @param frame2 previous image
+    /// @param sizeFrame size of the frame
+    /// @return completion handle
+    /// @note Frames sent, then refresh modelled by a non-blocking delay
+    ///
+    Driver_EPD_Handle updateFastAsync(FRAMEBUFFER_CONST_TYPE frame1, FRAMEBUFFER_CONST_TYPE frame2,
+                                      uint32_t sizeFrame);
+
+    ///
+    /// @brief Set the prefix of the snapshots
+    /// @param prefix path and name, default = 0 = no snapshot
+    /// @note One file per update, prefix_nnnn.pbm or prefix_nnnn.ppm
+    ///
+    void setSnapshot(const char * prefix = 0);
+
+    ///
+    /// @brief Set the modelled refresh durations
+    /// @param normal normal update, ms
+    /// @param fast fast update, ms
+    /// @note Replace the durations of the COG set by begin()
+    /// @note Durations at 20 °C and above, scaled by HOST_PARAMETER_DURATION below
+    ///
+    void setUpdateDuration(uint32_t normal, uint32_t fast);
+
+    ///
+    /// @brief Get the statistics
+    /// @return statistics since begin() or last clearStatistics()
+    ///
+    hostUpdate_t getStatistics();
+
+    ///
+    /// @brief Clear the statistics
+    ///
+    void clearStatistics();
+
+    ///
+    /// @brief Get the width of the screen
+    /// @return number of pixels per row, 0 = unknown size
+    ///
+    uint16_t getWidth();
+
+    ///
+    /// @brief Get the height of the screen
+    /// @return number of rows, 0 = unknown size
+    ///
+    uint16_t getHeight();
+
+  protected:
+
+    ///
+    /// @brief Compute the update parameters for a band
+    /// @param[in] temperatureC temperature in °C, within the band
+    /// @param[out] parameters HOST_PARAMETER_TEMPERATURE to HOST_PARAMETER_DURATION
+    /// @note Temperature for the fast update offset by 0x40 on films with embedded fast update
+    ///
+    void d_computeParameters(int8_t temperatureC, updateParameters_t & parameters);
+
+  private:
+
+    ///
+    /// @brief Reset and send the frame planes
+    /// @param flagFast true = fast update
+    /// @note Frame planes in _plane[], black and red, master then slave
+    ///
+    void _send(bool flagFast);
+
+    ///
+    /// @brief Simulate an update
+    /// @param duration modelled refresh duration, ms
+    /// @param flagFast true = fast update
+    ///
+    void _update(uint32_t duration, bool flagFast);
+
+    ///
+    /// @brief Simulate an asynchronous update
+    /// @param duration modelled refresh duration, ms
+    /// @param flagFast true = fast update
+    /// @return completion handle
+    ///
+    Driver_EPD_Handle _updateAsync(uint32_t duration, bool flagFast);
+
+    ///
+    /// @brief Write the snapshot of the frame planes
+    ///
+    void _snapshot();
+
+    ///
+    /// @brief Get the colour of a pixel from the frame planes
+    /// @param x column, pixels
+    /// @param y row
+    /// @return HOST_COLOUR_WHITE to HOST_COLOUR_YELLOW
+    ///
+    uint8_t _getColour(uint16_t x, uint16_t y);
+
+    const uint8_t * _plane[4] = { 0 }; // black and red, master then slave
+    uint32_t _size = 0; // bytes per plane
+    uint64_t _chrono = 0; // us, start of update
+    uint8_t _sequence[16]; // refresh of asynchronous update
+    std::string _prefix;
+    hostUpdate_t _statistics = {};
+    uint32_t _durationNormal = 0; // ms
+    uint32_t _durationFast = 0; // ms
+    uint32_t _snapshotNumber = 0;
+    uint16_t _width = 0; // pixels
+    uint16_t _height = 0; // rows
+    bool _flagFast = false; // true = second plane is previous image
+};
+
+#endif // hV_HAL_HOST
+
+#endif // DRIVER_EPD_HOST_RELEASE
@@ -0,0 +1,234 @@
+//
+// Driver_EPD_Queue.cpp
+// Class library C++ code
+// ----------------------------------
+//
+// Project Pervasive Displays Library Suite
+// Based on highView technology
+//
+// Created by Rei Vilo, 17 Oct 2026
+//
+// @copyright (c) Pervasive Displays Inc., 2021-2025
+// Copyright (c) Etigues, 2010-2025
+// Licence All rights reserved
+// For exclusive use with Pervasive Displays screens
+//
+// Release 1000: Initial release
+//
+
+#include "Driver_EPD_Queue.h"
+
+///
+/// @brief Merge a request with the pending update
+/// @param pending QUEUE_UPDATE_NONE to QUEUE_UPDATE_NORMAL_2
+/// @param type QUEUE_UPDATE_FAST to QUEUE_UPDATE_NORMAL_2
+/// @return resulting update
+///
+static uint8_t h_merge(uint8_t pending, uint8_t type)
+{
+    if ((pending == QUEUE_UPDATE_NONE) or (type == QUEUE_UPDATE_NORMAL_2))
+    {
+        return type;
+    }
+    if (pending == QUEUE_UPDATE_NORMAL_2)
+    {
+        // Red frame kept for a fast request, replaced by a normal request
+        return (type == QUEUE_UPDATE_FAST) ? QUEUE_UPDATE_NORMAL_2 : type;
+    }
+    if ((pending == QUEUE_UPDATE_NORMAL) or (type == QUEUE_UPDATE_NORMAL))
+    {
+        return QUEUE_UPDATE_NORMAL;
+    }
+    return QUEUE_UPDATE_FAST;
+}
+
+Driver_EPD_Queue::Driver_EPD_Queue(Driver_EPD_Virtual * driver)
+{
+    _driver = driver;
+}
+
+void Driver_EPD_Queue::begin(uint8_t * buffer, uint32_t size, uint32_t latency)
+{
+    _next = buffer;
+    _second = buffer + size;
+    _size = size;
+    _latency = latency;
+    _pending = QUEUE_UPDATE_NONE;
+    _lateType = QUEUE_UPDATE_NONE;
+    _flagUpdate = false;
+    _counters = {};
+}
+
+void Driver_EPD_Queue::setLatency(uint32_t latency)
+{
+    _latency = latency;
+}
+
+void Driver_EPD_Queue::updateNormal(FRAMEBUFFER_CONST_TYPE frame, uint32_t sizeFrame)
+{
+    _counters.requests++;
+    if (sizeFrame != _size)
+    {
+        if (_bypass())
+        {
+            _driver->updateNormal(frame, sizeFrame);
+        }
+        return;
+    }
+
+    _request(QUEUE_UPDATE_NORMAL, frame, 0);
+}
+
+void Driver_EPD_Queue::updateNormal(FRAMEBUFFER_CONST_TYPE frame1, FRAMEBUFFER_CONST_TYPE frame2, uint32_t sizeFrame)
+{
+    _counters.requests++;
+    if (sizeFrame != _size)
+    {
+        if (_bypass())
+        {
+            _driver->updateNormal(frame1, frame2, sizeFrame);
+        }
+        return;
+    }
+
+    _request(QUEUE_UPDATE_NORMAL_2, frame1, frame2);
+}
+
+void Driver_EPD_Queue::updateFast(FRAMEBUFFER_CONST_TYPE frame1, FRAMEBUFFER_CONST_TYPE frame2, uint32_t sizeFrame)
+{
+    _counters.requests++;
+    if (sizeFrame != _size)
+    {
+        if (_bypass())
+        {
+            _driver->updateFast(frame1, frame2, sizeFrame);
+        }
+        return;
+    }
+
+    _request(QUEUE_UPDATE_FAST, frame1, frame2);
+}
+
+bool Driver_EPD_Queue::_bypass()
+{
+    if (_flagUpdate)
+    {
+        // Frame not copied, not kept by reference either
+        _counters.rejected++;
+        return false;
+    }
+
+    // Older pending update first
+    flush();
+    _counters.bypass++;
+    return true;
+}
+
+void Driver_EPD_Queue::_request(uint8_t type, const uint8_t * frame1, const uint8_t * frame2)
+{
+    if (_flagUpdate)
+    {
+        // Buffer in use, keep the newest frames by reference
+        // Fast request keeps the first previous image or the red frame
+        _lateFrame1 = frame1;
+        _lateFrame2 = ((type == QUEUE_UPDATE_FAST) and (_lateType != QUEUE_UPDATE_NONE)) ? _lateFrame2 : frame2;
+        _lateType = h_merge(_lateType, type);
+        return;
+    }
+
+    uint8_t pending = _pending;
+    if (pending == QUEUE_UPDATE_NONE)
+    {
+        _chrono = hV_HAL_getMilliseconds();
+    }
+
+    // Newest frame
+    memcpy(_next, frame1, _size);
+
+    // Fast update against the image on screen, from the first pending request
+    if ((type == QUEUE_UPDATE_NORMAL_2) or ((type == QUEUE_UPDATE_FAST) and (pending == QUEUE_UPDATE_NONE)))
+    {
+        memcpy(_second, frame2, _size);
+    }
+    _pending = h_merge(pending, type);
+
+    if (_latency == 0)
+    {
+        _run();
+    }
+}
+
+bool Driver_EPD_Queue::process()
+{
+    if ((_pending == QUEUE_UPDATE_NONE) or _flagUpdate)
+    {
+        return false;
+    }
+
+    if ((uint32_t)(hV_HAL_getMilliseconds() - _chrono) < _latency)
+    {
+        return false;
+    }
+
+    _run();
+    return true;
+}
+
+bool Driver_EPD_Queue::flush()
+{
+    if ((_pending == QUEUE_UPDATE_NONE) or _flagUpdate)
+    {
+        return false;
+    }
+
+    _run();
+    return true;
+}
+
+uint8_t Driver_EPD_Queue::getPending()
+{
+    return _pending;
+}
+
+queueCounter_t Driver_EPD_Queue::getCounters()
+{
+    return _counters;
+}
+
+void Driver_EPD_Queue::_run()
+{
+    _flagUpdate = true;
+
+    switch (_pending)
+    {
+        case QUEUE_UPDATE_FAST:
+
+            _driver->updateFast(_next, _second, _size);
+            break;
+
+        case QUEUE_UPDATE_NORMAL:
+
+            _driver->updateNormal(_next, _size);
+            break;
+
+        case QUEUE_UPDATE_NORMAL_2:
+
+            _driver->updateNormal(_next, _second, _size);
+            break;
+
+        default:
+
+            break;
+    }
+    _counters.updates++;
+    _pending = QUEUE_UPDATE_NONE;
+    _flagUpdate = false;
+
+    // Request during the update, now queued with the latency bound
+    if (_lateType != QUEUE_UPDATE_NONE)
+    {
+        uint8_t type = _lateType;
+        _lateType = QUEUE_UPDATE_NONE;
+        _request(type, _lateFrame1, _lateFrame2);
+    }
+}
@@ -0,0 +1,210 @@
+///
+/// @file Driver_EPD_Queue.h
+/// @brief Update queue in front of a driver - Basic edition
+///
+/// @details Project Pervasive Displays Library Suite
+/// @n Based on highView technology
+/// @n Coalesces the update requests into fewer physical refreshes
+/// * Requests collapse to the newest frame while an update is pending or ongoing
+/// * First pending request held at most for the latency bound
+/// * Fast update against the image on screen, the previous image of the first pending request
+///
+/// @date 17 Oct 2026
+/// @version 1000
+///
+/// @copyright (c) Pervasive Displays Inc., 2021-2025
+/// @copyright (c) Etigues, 2010-2025
+/// @copyright All rights reserved
+/// @copyright For exclusive use with Pervasive Displays screens
+///
+/// * Basic edition: for hobbyists and for basic usage
+/// @n Creative Commons Attribution-ShareAlike 4.0 International (CC BY-SA 4.0)
+/// @see https://creativecommons.org/licenses/by-sa/4.0/
+///
+/// @n Consider the Evaluation or Commercial editions for professionals or organisations and for commercial usage
+///
+/// * Evaluation edition: for professionals or organisations, evaluation only, no commercial usage
+/// @n All rights reserved
+///
+/// * Commercial edition: for professionals or organisations, commercial usage
+/// @n All rights reserved
+///
+/// * Viewer edition: for professionals or organisations
+/// @n All rights reserved
+///
+/// * Documentation
+/// @n All rights reserved
+///
+/// @note Example with a latency bound of 500 ms
+/// @code {.cpp}
+/// uint8_t bufferQueue[2 * frameSize_EPD_271 / 2];
+/// Driver_EPD_Queue queue(&myDriver);
+///
+/// queue.begin(bufferQueue, frameSize_EPD_271 / 2, 500);
+/// queue.updateFast(frameNext, framePrevious, frameSize_EPD_271 / 2); // queued
+///
+/// void loop()
+/// {
+///     queue.process(); // update when the latency bound is reached
+/// }
+/// @endcode
+///
+
+// Driver
+#include "Driver_EPD_Virtual.h"
+
+#if (DRIVER_EPD_VIRTUAL_RELEASE < 1000)
+#error Required DRIVER_EPD_VIRTUAL_RELEASE 1000
+#endif // DRIVER_EPD_VIRTUAL_RELEASE
+
+#ifndef DRIVER_EPD_QUEUE_RELEASE
+///
+/// @brief Library release number
+///
+#define DRIVER_EPD_QUEUE_RELEASE 1000
+
+///
+/// @name Types of pending update
+/// @note Numbers are sequential and exclusive
+/// @{
+#define QUEUE_UPDATE_NONE 0x00 ///< No update pending
+#define QUEUE_UPDATE_FAST 0x01 ///< Fast update, next and previous images
+#define QUEUE_UPDATE_NORMAL 0x02 ///< Normal update, one frame
+#define QUEUE_UPDATE_NORMAL_2 0x03 ///< Normal update, black and red frames
+/// @}
+
+///
+/// @brief Counters of the update queue
+///
+struct queueCounter_t
+{
+    uint32_t requests; ///< number of update requests
+    uint32_t updates; ///< number of physical updates
+    uint32_t bypass; ///< number of requests sent directly, frame size other than buffer
+    uint32_t rejected; ///< number of requests dropped, frame size other than buffer during an update
+};
+
+///
+/// @brief Update queue class
+/// @details Layer over the Driver_EPD_Virtual interface
+/// * Normal request absorbs the pending fast requests
+/// * Fast request pending with a normal request keeps the normal update, with the newest frame
+/// * Fast request pending with a two-frame normal request keeps the red frame
+/// * Request with another frame size sent directly after the pending update,
+/// or dropped during an ongoing update
+/// @note Small and medium screens only
+///
+class Driver_EPD_Queue
+{
+  public:
+
+    ///
+    /// @brief Constructor
+    /// @param driver driver for the physical updates
+    ///
+    Driver_EPD_Queue(Driver_EPD_Virtual * driver);
+
+    ///
+    /// @brief Initialisation
+    /// @param buffer buffer for two frames, 2 * size bytes
+    /// @param size size of one frame
+    /// @param latency latency bound, ms, default = 0 = update at once if no update ongoing
+    /// @note Frames copied, the application may change them once the request is queued
+    ///
+    void begin(uint8_t * buffer, uint32_t size, uint32_t latency = 0);
+
+    ///
+    /// @brief Set the latency bound
+    /// @param latency maximum time a request is held, ms
+    ///
+    void setLatency(uint32_t latency);
+
+    ///
+    /// @brief Request a normal update
+    /// @param frame next image
+    /// @param sizeFrame size of the frame
+    ///
+    void updateNormal(FRAMEBUFFER_CONST_TYPE frame, uint32_t sizeFrame);
+
+    ///
+    /// @brief Request a normal update
+    /// @param frame1 next image, black
+    /// @param frame2 next image, red
+    /// @param sizeFrame size of the frame
+    ///
+    void updateNormal(FRAMEBUFFER_CONST_TYPE frame1, FRAMEBUFFER_CONST_TYPE frame2, uint32_t sizeFrame);
+
+    ///
+    /// @brief Request a fast update
+    /// @param frame1 next image
+    /// @param frame2 previous image
+    /// @param sizeFrame size of the frame
+    /// @warning Request from an interrupt or another task during an ongoing update:
+    /// frames kept by reference and copied when the update ends
+    ///
+    void updateFast(FRAMEBUFFER_CONST_TYPE frame1, FRAMEBUFFER_CONST_TYPE frame2, uint32_t sizeFrame);
+
+    ///
+    /// @brief Run the pending update if the latency bound is reached
+    /// @return true if an update was run
+    /// @note Call from an idle hook, for example loop()
+    ///
+    bool process();
+
+    ///
+    /// @brief Run the pending update now
+    /// @return true if an update was run
+    ///
+    bool flush();
+
+    ///
+    /// @brief Get the pending update
+    /// @return QUEUE_UPDATE_NONE to QUEUE_UPDATE_NORMAL_2
+    ///
+    uint8_t getPending();
+
+    ///
+    /// @brief Get the counters
+    /// @return counters since begin()
+    ///
+    queueCounter_t getCounters();
+
+  private:
+
+    ///
+    /// @brief Prepare a request with another frame size
+    /// @return true if to be sent directly, false if dropped during an ongoing update
+    /// @note Pending update run before
+    ///
+    bool _bypass();
+
+    ///
+    /// @brief Queue a request
+    /// @param type QUEUE_UPDATE_FAST to QUEUE_UPDATE_NORMAL_2
+    /// @param frame1 next image
+    /// @param frame2 previous image or red frame, 0 = none
+    ///
+    void _request(uint8_t type, const uint8_t * frame1, const uint8_t * frame2);
+
+    ///
+    /// @brief Run the pending update
+    ///
+    void _run();
+
+    Driver_EPD_Virtual * _driver;
+    uint8_t * _next = 0; // next image, or black frame
+    uint8_t * _second = 0; // previous image, or red frame
+    uint32_t _size = 0;
+    uint32_t _latency = 0; // ms
+    uint32_t _chrono = 0; // ms, first pending request
+    queueCounter_t _counters = {};
+    volatile uint8_t _pending = QUEUE_UPDATE_NONE;
+    volatile bool _flagUpdate = false; // true = update ongoing
+
+    // Request during the ongoing update, copied once the update ends
+    volatile uint8_t _lateType = QUEUE_UPDATE_NONE;
+    const uint8_t * volatile _lateFrame1 = 0;
+    const uint8_t * volatile _lateFrame2 = 0;
+};
+
+#endif // DRIVER_EPD_QUEUE_RELEASE
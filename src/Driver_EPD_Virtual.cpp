@@ -17,6 +17,10 @@
 // Release 902: Improved stability
 // Release 906: Added fixes for GCC errors
 // Release 912: Added temperature functions to driver
+// Release 1000: Added fast update of a window
+// Release 1000: Added asynchronous updates with completion handle
+// Release 1000: Added fast update of the changes
+// Release 1000: Added cache of update parameters per temperature band
 //
 
 #include "Driver_EPD_Virtual.h"
@@ -30,6 +34,14 @@ Driver_EPD_Virtual::Driver_EPD_Virtual(eScreen_EPD_t eScreen_EPD, pins_t board)
     // . default member initializer required before the end of its enclosing class
     u_temperature = 25;
     u_flagOTP = false; // OTP not read
+    u_updateNumber = 0;
+    u_updateStatus = UPDATE_STATUS_DONE;
+    u_lastNumber = 0;
+    u_lastStatus = UPDATE_STATUS_DONE;
+    u_lastElapsed = 0;
+    u_cacheCOG = COG_NONE;
+    d_COG = COG_NONE; // Set by the driver
+    u_band = TEMPERATURE_BAND_NUMBER; // None
 }
 
 void Driver_EPD_Virtual::begin()
@@ -40,6 +52,50 @@ void Driver_EPD_Virtual::begin()
 void Driver_EPD_Virtual::setTemperatureC(int8_t temperatureC)
 {
     u_temperature = temperatureC;
+
+    uint8_t band = d_getTemperatureBand(temperatureC);
+    if ((band != u_band) or (d_COG != u_cacheCOG))
+    {
+        u_getParameters();
+    }
+}
+
+const updateParameters_t & Driver_EPD_Virtual::u_getParameters()
+{
+    // Cache invalidated by change of COG
+    if (d_COG != u_cacheCOG)
+    {
+        for (uint8_t index = 0; index < TEMPERATURE_BAND_NUMBER; index++)
+        {
+            u_cacheParameters[index].flagValid = false;
+        }
+        u_cacheCOG = d_COG;
+        u_band = TEMPERATURE_BAND_NUMBER; // None
+    }
+
+    u_band = d_getTemperatureBand(u_temperature);
+
+    updateParameters_t & parameters = u_cacheParameters[u_band];
+    if (not parameters.flagValid)
+    {
+        d_computeParameters(u_temperature, parameters);
+        parameters.flagValid = true;
+    }
+    return parameters;
+}
+
+uint8_t Driver_EPD_Virtual::d_getTemperatureBand(int8_t temperatureC)
+{
+    int16_t band = ((int16_t)temperatureC - TEMPERATURE_BAND_MINIMUM) / TEMPERATURE_BAND_WIDTH;
+    return (uint8_t)checkRange(band, (int16_t)0, (int16_t)(TEMPERATURE_BAND_NUMBER - 1));
+}
+
+void Driver_EPD_Virtual::d_computeParameters(int8_t temperatureC, updateParameters_t & parameters)
+{
+    // Lowest temperature of the band
+    int8_t lowest = TEMPERATURE_BAND_MINIMUM + d_getTemperatureBand(temperatureC) * TEMPERATURE_BAND_WIDTH;
+    parameters.data[0] = (uint8_t)lowest;
+    parameters.length = 1;
 }
 
 void Driver_EPD_Virtual::setTemperatureF(int16_t temperatureF)
@@ -51,33 +107,221 @@ void Driver_EPD_Virtual::setTemperatureF(int16_t temperatureF)
 void Driver_EPD_Virtual::updateNormal(FRAMEBUFFER_CONST_TYPE frame,
                                       uint32_t size)
 {
-    ;
+    (void)frame;
+    (void)size;
 }
 
 void Driver_EPD_Virtual::updateNormal(FRAMEBUFFER_CONST_TYPE frame1, FRAMEBUFFER_CONST_TYPE frame2,
                                       uint32_t size)
 {
-    ;
+    (void)frame1;
+    (void)frame2;
+    (void)size;
 }
 
 void Driver_EPD_Virtual::updateNormal(FRAMEBUFFER_CONST_TYPE frameM1, FRAMEBUFFER_CONST_TYPE frameM2,
                                       FRAMEBUFFER_CONST_TYPE frameS1, FRAMEBUFFER_CONST_TYPE frameS2,
                                       uint32_t size)
 {
-    ;
+    (void)frameM1;
+    (void)frameM2;
+    (void)frameS1;
+    (void)frameS2;
+    (void)size;
 }
 
 void Driver_EPD_Virtual::updateFast(FRAMEBUFFER_CONST_TYPE frame1, FRAMEBUFFER_CONST_TYPE frame2,
                                     uint32_t size)
 {
-    ;
+    (void)frame1;
+    (void)frame2;
+    (void)size;
+}
+
+void Driver_EPD_Virtual::updateFast(FRAMEBUFFER_CONST_TYPE frame1, FRAMEBUFFER_CONST_TYPE frame2,
+                                    uint32_t size, window_t window, uint16_t stride)
+{
+    if (b_clipWindow(window, size, stride) == false)
+    {
+        return; // Empty window or outside the frame
+    }
+
+    // No RAM window, full update
+    updateFast(frame1, frame2, size);
+}
+
+bool Driver_EPD_Virtual::updateFastChanged(FRAMEBUFFER_CONST_TYPE frame1, FRAMEBUFFER_CONST_TYPE frame2,
+                                           uint32_t size, uint16_t stride)
+{
+    // Columns in pixels and rows within window_t
+    if ((stride == 0) or (stride > 0xffff / 8) or ((size - 1) / stride >= 0xffff))
+    {
+        return false;
+    }
+
+    frameDiff_t diff;
+    if (diffFrames(frame1, frame2, size, stride, diff) == 0)
+    {
+        return false; // Identical frames
+    }
+
+    window_t window;
+    window.x = diff.columnFirst * 8;
+    window.y = diff.rowFirst;
+    window.dx = (diff.columnLast - diff.columnFirst + 1) * 8;
+    window.dy = diff.rowLast - diff.rowFirst + 1;
+
+    updateFast(frame1, frame2, size, window, stride);
+    return true;
 }
 
 void Driver_EPD_Virtual::updateFast(FRAMEBUFFER_CONST_TYPE frameM1, FRAMEBUFFER_CONST_TYPE frameM2,
                                     FRAMEBUFFER_CONST_TYPE frameS1, FRAMEBUFFER_CONST_TYPE frameS2,
                                     uint32_t size)
 {
-    ;
+    (void)frameM1;
+    (void)frameM2;
+    (void)frameS1;
+    (void)frameS2;
+    (void)size;
+}
+
+Driver_EPD_Handle Driver_EPD_Virtual::updateNormalAsync(FRAMEBUFFER_CONST_TYPE frame,
+                                                      uint32_t size)
+{
+    // No non-blocking update, blocking update
+    uint32_t chrono = hV_HAL_getMilliseconds();
+    updateNormal(frame, size);
+
+    return Driver_EPD_Handle(0, 0, chrono, UPDATE_STATUS_DONE);
+}
+
+Driver_EPD_Handle Driver_EPD_Virtual::updateFastAsync(FRAMEBUFFER_CONST_TYPE frame1, FRAMEBUFFER_CONST_TYPE frame2,
+                                                    uint32_t size)
+{
+    // No non-blocking update, blocking update
+    uint32_t chrono = hV_HAL_getMilliseconds();
+    updateFast(frame1, frame2, size);
+
+    return Driver_EPD_Handle(0, 0, chrono, UPDATE_STATUS_DONE);
+}
+
+Driver_EPD_Handle Driver_EPD_Virtual::u_startAsync(const uint8_t * sequence, const uint8_t * const * planes, uint8_t number, uint32_t size)
+{
+    u_waitAsync();
+
+    // Result of the previous update, for its handle
+    u_lastNumber = u_updateNumber;
+    u_lastStatus = u_updateStatus;
+    u_lastElapsed = u_updateElapsed;
+
+    u_updateNumber++;
+    u_updateStart = hV_HAL_getMilliseconds();
+    u_updateElapsed = 0;
+    u_updateStatus = UPDATE_STATUS_ONGOING;
+
+    b_resetCOG = d_COG; // For SEQUENCE_RESET
+    b_startUpdate(sequence, planes, number, size);
+    u_stepAsync();
+
+    return Driver_EPD_Handle(this, u_updateNumber, u_updateStart, UPDATE_STATUS_ONGOING);
+}
+
+void Driver_EPD_Virtual::u_waitAsync()
+{
+    while (u_stepAsync() == UPDATE_STATUS_ONGOING)
+    {
+        yield();
+    }
+}
+
+uint8_t Driver_EPD_Virtual::u_stepAsync()
+{
+    if (u_updateStatus == UPDATE_STATUS_ONGOING)
+    {
+        uint8_t phase = b_stepUpdate();
+        if (phase >= UPDATE_PHASE_DONE)
+        {
+            u_updateStatus = (phase == UPDATE_PHASE_ERROR) ? UPDATE_STATUS_ERROR : UPDATE_STATUS_DONE;
+            u_updateElapsed = hV_HAL_getMilliseconds() - u_updateStart;
+        }
+    }
+    return u_updateStatus;
+}
+
+Driver_EPD_Handle::Driver_EPD_Handle(Driver_EPD_Virtual * driver, uint16_t number, uint32_t start, uint8_t status)
+{
+    _driver = driver;
+    _number = number;
+    _start = start;
+    _elapsed = (status == UPDATE_STATUS_ONGOING) ? 0 : (hV_HAL_getMilliseconds() - start);
+    _status = status;
+}
+
+bool Driver_EPD_Handle::isDone()
+{
+    if (_status == UPDATE_STATUS_ONGOING)
+    {
+        if (_driver->u_lastNumber == _number)
+        {
+            // Superseded, completed before the next update started
+            _status = _driver->u_lastStatus;
+            _elapsed = _driver->u_lastElapsed;
+        }
+        else if (_driver->u_updateNumber != _number)
+        {
+            // Superseded more than once, result no longer available
+            _status = UPDATE_STATUS_DONE;
+            _elapsed = 0;
+        }
+        else if (_driver->u_stepAsync() != UPDATE_STATUS_ONGOING)
+        {
+            _status = _driver->u_updateStatus;
+            _elapsed = _driver->u_updateElapsed;
+        }
+    }
+    return (_status != UPDATE_STATUS_ONGOING);
+}
+
+uint8_t Driver_EPD_Handle::wait(uint32_t timeout)
+{
+    uint32_t chrono = hV_HAL_getMilliseconds();
+
+    while (not isDone())
+    {
+        uint32_t elapsed = hV_HAL_getMilliseconds() - chrono;
+        if ((timeout > 0) and (elapsed >= timeout))
+        {
+            break;
+        }
+
+        // Sleep until the next action, polling for panelBusy
+        uint32_t due = _driver->b_getUpdateDue();
+        if (due == UPDATE_DUE_BUSY)
+        {
+            due = 1;
+        }
+        if (timeout > 0)
+        {
+            due = hV_HAL_min(due, timeout - elapsed);
+        }
+        hV_HAL_delayMilliseconds(due);
+    }
+    return _status;
+}
+
+uint32_t Driver_EPD_Handle::getElapsed()
+{
+    if (_status == UPDATE_STATUS_ONGOING)
+    {
+        return hV_HAL_getMilliseconds() - _start;
+    }
+    return _elapsed;
+}
+
+uint8_t Driver_EPD_Handle::getStatus()
+{
+    return _status;
 }
 
 // void Driver_EPD_Virtual::COG_reset()
@@ -59,6 +59,103 @@
 #error Required hV_UTILITIES_RELEASE 1000
 #endif // hV_UTILITIES_RELEASE
 
+///
+/// @name Status of asynchronous update
+/// @note Numbers are sequential and exclusive
+/// @{
+#define UPDATE_STATUS_ONGOING 0x00 ///< Update ongoing
+#define UPDATE_STATUS_DONE 0x01 ///< Update completed
+#define UPDATE_STATUS_ERROR 0x02 ///< Update stopped by busy timeout
+/// @}
+
+///
+/// @name Temperature bands for the cache of update parameters
+/// @{
+#define TEMPERATURE_BAND_MINIMUM (-40) ///< lowest temperature of first band, °C
+#define TEMPERATURE_BAND_WIDTH (10) ///< width of each band, °C
+#define TEMPERATURE_BAND_NUMBER (13) ///< number of bands, -40 to +89 °C
+/// @}
+
+///
+/// @brief Number of bytes of update parameters
+///
+#define UPDATE_PARAMETERS_LENGTH 8
+
+///
+/// @brief Update parameters derived from temperature
+/// @note Content defined by each driver
+///
+struct updateParameters_t
+{
+    uint8_t data[UPDATE_PARAMETERS_LENGTH]; ///< parameters, for example register values
+    uint8_t length; ///< number of bytes used
+    bool flagValid; ///< true = computed
+};
+
+class Driver_EPD_Virtual;
+
+///
+/// @brief Completion handle of an asynchronous update
+/// @details Returned by updateNormalAsync() and updateFastAsync()
+/// @note Small, returned by value
+/// @code {.cpp}
+/// Driver_EPD_Handle handle = myDriver.updateFastAsync(frameNext, framePrevious, sizeFrame);
+/// while (not handle.isDone())
+/// {
+///     // Render next frame, service radio
+/// }
+/// @endcode
+///
+class Driver_EPD_Handle
+{
+  public:
+
+    ///
+    /// @brief Constructor
+    /// @param driver driver running the update, default = 0 = completed
+    /// @param number update number
+    /// @param start start time, ms
+    /// @param status UPDATE_STATUS_ONGOING to UPDATE_STATUS_ERROR
+    ///
+    Driver_EPD_Handle(Driver_EPD_Virtual * driver = 0, uint16_t number = 0, uint32_t start = 0, uint8_t status = UPDATE_STATUS_DONE);
+
+    ///
+    /// @brief Check whether the update is completed
+    /// @return true if completed, with or without error
+    /// @note Advances the update, non-blocking
+    /// @note Update superseded by the next one: status and duration recorded by the driver
+    /// * Superseded more than once: done, duration 0
+    ///
+    bool isDone();
+
+    ///
+    /// @brief Wait for the update to complete
+    /// @param timeout maximum wait, ms, default = 0 = none
+    /// @return UPDATE_STATUS_ONGOING if timeout, otherwise UPDATE_STATUS_DONE or UPDATE_STATUS_ERROR
+    ///
+    uint8_t wait(uint32_t timeout = 0);
+
+    ///
+    /// @brief Get the elapsed time
+    /// @return ms since start, or duration once completed
+    ///
+    uint32_t getElapsed();
+
+    ///
+    /// @brief Get the status
+    /// @return UPDATE_STATUS_ONGOING to UPDATE_STATUS_ERROR
+    ///
+    uint8_t getStatus();
+
+  private:
+
+    Driver_EPD_Virtual * _driver;
+    uint16_t _number;
+    uint32_t _start; // ms
+    uint32_t _elapsed; // ms
+    uint8_t _status;
+};
+
 ///
 /// @brief Generic driver class
 /// @details This class provides the functions for the drivers
@@ -66,6 +163,7 @@
 class Driver_EPD_Virtual: public hV_Board
 {
     friend class Screen_EPD;
+    friend class Driver_EPD_Handle;
 
   public:
 
@@ -104,6 +202,7 @@ class Driver_EPD_Virtual: public hV_Board
     /// @details Set the temperature for update
     /// @param temperatureC temperature in °C, default = 25 °C
     /// @note Refer to data-sheets for authorised operating temperatures
+    /// @note Update parameters taken from the cache, computed at first use of the band
     ///
     void setTemperatureC(int8_t temperatureC = 25);
 
@@ -173,6 +272,38 @@ class Driver_EPD_Virtual: public hV_Board
     virtual void updateFast(FRAMEBUFFER_CONST_TYPE frame1, FRAMEBUFFER_CONST_TYPE frame2,
                             uint32_t sizeFrame);
 
+    ///
+    /// @brief Fast update of a window
+    /// @details Scope
+    /// * Fast BW small and medium screens, with embedded fast update and RAM window
+    /// * Wide BW small and medium screens, with embedded fast update and RAM window
+    /// @param frame1 next image
+    /// @param frame2 previous image
+    /// @param sizeFrame size of the frame
+    /// @param window rectangle with changes, in pixels
+    /// @param stride number of bytes per row
+    /// @note Drivers with RAM window send only the window, with b_sendIndexDataWindow()
+    /// @note Window clipped to the frame with b_clipWindow(), no update if empty
+    /// @note Default is full update with updateFast(frame1, frame2, sizeFrame)
+    ///
+    virtual void updateFast(FRAMEBUFFER_CONST_TYPE frame1, FRAMEBUFFER_CONST_TYPE frame2,
+                            uint32_t sizeFrame, window_t window, uint16_t stride);
+
+    ///
+    /// @brief Fast update of the changes
+    /// @details Scope
+    /// * Fast BW small and medium screens, with embedded fast update
+    /// * Wide BW small and medium screens, with wide temperature and embedded fast update
+    /// @param frame1 next image
+    /// @param frame2 previous image
+    /// @param sizeFrame size of the frame
+    /// @param stride number of bytes per row, 1 to 8191
+    /// @return true if updated, false if identical frames, stride out of range or more than 65535 rows, and no update
+    /// @note Bounding box of the changes from diffFrames(), sent with the window fast update
+    ///
+    bool updateFastChanged(FRAMEBUFFER_CONST_TYPE frame1, FRAMEBUFFER_CONST_TYPE frame2,
+                           uint32_t sizeFrame, uint16_t stride);
+
     ///
     /// @brief Fast update
     /// @details Scope
@@ -188,14 +319,97 @@ class Driver_EPD_Virtual: public hV_Board
                             FRAMEBUFFER_CONST_TYPE frameS1, FRAMEBUFFER_CONST_TYPE frameS2,
                             uint32_t sizeFrame);
 
+    ///
+    /// @brief Asynchronous normal update
+    /// @param frame next image
+    /// @param sizeFrame size of the frame
+    /// @return completion handle
+    /// @note Drivers with a non-blocking update return once the frame is sent,
+    /// default is updateNormal() and a completed handle
+    /// @warning Frame must remain unchanged until completion
+    ///
+    virtual Driver_EPD_Handle updateNormalAsync(FRAMEBUFFER_CONST_TYPE frame,
+                                                uint32_t sizeFrame);
+
+    ///
+    /// @brief Asynchronous fast update
+    /// @param frame1 next image
+    /// @param frame2 previous image
+    /// @param sizeFrame size of the frame
+    /// @return completion handle
+    /// @note Drivers with a non-blocking update return once the frames are sent,
+    /// default is updateFast() and a completed handle
+    /// @warning Frames must remain unchanged until completion
+    ///
+    virtual Driver_EPD_Handle updateFastAsync(FRAMEBUFFER_CONST_TYPE frame1, FRAMEBUFFER_CONST_TYPE frame2,
+                                              uint32_t sizeFrame);
+
   protected:
 
+    ///
+    /// @brief Start the refresh of an asynchronous update
+    /// @param sequence steps after the frames are sent, see b_startUpdate()
+    /// @param planes frame planes for SEQUENCE_FRAME(), default = 0 = none
+    /// @param number number of frame planes
+    /// @param size number of bytes per frame plane
+    /// @return completion handle
+    /// @note Previous asynchronous update completed first
+    ///
+    Driver_EPD_Handle u_startAsync(const uint8_t * sequence, const uint8_t * const * planes = 0, uint8_t number = 0, uint32_t size = 0);
+
+    ///
+    /// @brief Advance the asynchronous update
+    /// @return UPDATE_STATUS_ONGOING to UPDATE_STATUS_ERROR
+    ///
+    uint8_t u_stepAsync();
+
+    ///
+    /// @brief Complete the asynchronous update
+    /// @note Call before sending to the panel
+    ///
+    void u_waitAsync();
+
+    ///
+    /// @brief Get the update parameters for the current temperature
+    /// @return parameters from the cache
+    /// @note Constant time, computed only at first use of the band or after a change of COG
+    ///
+    const updateParameters_t & u_getParameters();
+
+    ///
+    /// @brief Get the temperature band
+    /// @param temperatureC temperature in °C
+    /// @return band, 0 to TEMPERATURE_BAND_NUMBER - 1
+    /// @note Default bands of TEMPERATURE_BAND_WIDTH °C from TEMPERATURE_BAND_MINIMUM °C
+    ///
+    virtual uint8_t d_getTemperatureBand(int8_t temperatureC);
+
+    ///
+    /// @brief Compute the update parameters for a band
+    /// @param[in] temperatureC temperature in °C, within the band
+    /// @param[out] parameters update parameters
+    /// @note Default is a placeholder, the lowest temperature of the band as single byte,
+    /// to be replaced by each driver, see Driver_EPD_Host::d_computeParameters()
+    /// @warning Result must depend on the band and d_COG only
+    ///
+    virtual void d_computeParameters(int8_t temperatureC, updateParameters_t & parameters);
+
     eScreen_EPD_t u_eScreen_EPD;
     int8_t u_temperature = 25;
     // uint8_t u_suspendMode = POWER_MODE_AUTO;
     // uint8_t u_suspendScope = POWER_SCOPE_GPIO_ONLY;
     bool u_flagOTP = false; // true = OTP read
-    uint16_t d_COG; // Identifier with film and family
+    uint16_t u_updateNumber = 0; // asynchronous update
+    uint32_t u_updateStart = 0; // ms
+    uint32_t u_updateElapsed = 0; // ms
+    uint8_t u_updateStatus = UPDATE_STATUS_DONE;
+    uint16_t u_lastNumber = 0; // previous asynchronous update
+    uint8_t u_lastStatus = UPDATE_STATUS_DONE;
+    uint32_t u_lastElapsed = 0; // ms
+    updateParameters_t u_cacheParameters[TEMPERATURE_BAND_NUMBER] = {};
+    uint16_t u_cacheCOG = COG_NONE; // COG of the cached parameters
+    uint8_t u_band = TEMPERATURE_BAND_NUMBER; // current band, TEMPERATURE_BAND_NUMBER = none
+    uint16_t d_COG = COG_NONE; // Identifier with film and family
 
     //
     // === Touch section
@@ -21,11 +21,71 @@
 // Release 900: Consolidated constants
 // Release 906: Added check for panel power
 // Release 1000: Unified boards definition
+// Release 1001: Improved SPI throughput with buffer write
+// Release 1001: Added asynchronous data send
+// Release 1001: Improved fixed value send
+// Release 1001: Added SPI clock profiles for command and data
+// Release 1001: Added shared SPI bus arbitration
+// Release 1001: Added timing profiles with calibration
+// Release 1001: Added command sequences
+// Release 1001: Added edge-triggered wait for ready with timeout
+// Release 1001: Added non-blocking update
+// Release 1001: Added split send for large screens
+// Release 1001: Added data send from a producer
+// Release 1001: Added data send from the frame store
+// Release 1001: Added window send
+// Release 1001: Added automatic power mode and fast resume
+// Release 1001: Added reset profiles per COG with warm reset
+// Release 1001: Fixed frame store send with index per chunk and shared bus check
+// Release 1001: Fixed reset delays beyond 65535 ms
 //
 
 // Library header
 #include "hV_Board.h"
 
+///
+/// @brief Cache of calibrated timing profiles
+/// @note Index = family
+///
+struct h_timingCache_t
+{
+    timing_t timing[FAMILY_LARGE + 1]; ///< calibrated profiles
+    bool flag[FAMILY_LARGE + 1]; ///< true = calibrated
+};
+
+static h_timingCache_t h_timingCache = { {}, {false} };
+
+///
+/// @brief Reset timing profile of a COG
+///
+struct h_resetProfile_t
+{
+    uint16_t cog; ///< COG identifier
+    resetTiming_t timing; ///< delays, ms
+};
+
+///
+/// @brief Table of reset timing profiles
+/// @note Last entry COG_NONE, conservative profile for unknown COG
+///
+static const h_resetProfile_t h_resetProfile[] =
+{
+    { COG_NORMAL_SMALL, { 5, 5, 10, 5, 5 } },
+    { COG_NORMAL_MEDIUM, { 5, 5, 10, 5, 5 } },
+    { COG_NORMAL_LARGE, { 200, 20, 200, 200, 5 } },
+    { COG_FAST_SMALL, { 200, 20, 200, 50, 5 } },
+    { COG_FAST_MEDIUM, { 200, 20, 200, 50, 5 } },
+    { COG_FAST_LARGE, { 200, 20, 200, 50, 5 } },
+    { COG_WIDE_SMALL, { 5, 5, 10, 5, 5 } },
+    { COG_WIDE_MEDIUM, { 5, 5, 10, 5, 5 } },
+    { COG_WIDE_LARGE, { 200, 20, 200, 50, 5 } },
+    { COG_TOUCH_SMALL, { 5, 5, 10, 5, 5 } },
+    { COG_BWRY_SMALL, { 200, 20, 200, 50, 5 } },
+    { COG_BWRY_MEDIUM, { 200, 20, 200, 50, 5 } },
+    { COG_BWRY_LARGE, { 200, 20, 200, 200, 5 } },
+    { COG_NONE, { 200, 20, 200, 200, 5 } }
+};
+
 hV_Board::hV_Board()
 {
     b_fsmPowerScreen = FSM_OFF;
@@ -35,26 +95,139 @@ void hV_Board::b_begin(pins_t board, uint8_t family, uint16_t delayCS)
 {
     b_pin = board;
     b_family = family;
-    b_delayCS = delayCS;
     b_fsmPowerScreen = FSM_OFF;
+    b_planNumber = 0;
+    b_flagGpioLost = true;
+    b_flagPowerWarm = false;
+
+    if ((family <= FAMILY_LARGE) and h_timingCache.flag[family])
+    {
+        b_timing = h_timingCache.timing[family];
+    }
+    else
+    {
+        // Same delays as before the profiles, 450 us for slave with panelCSS
+        bool flagSlave = (family == FAMILY_LARGE) or (board.panelCSS != NOT_CONNECTED);
+        b_timing = { delayCS, delayCS, delayCS, (uint16_t)(flagSlave ? 450 : 0) };
+    }
+}
+
+void hV_Board::b_setTiming(timing_t timing)
+{
+    b_timing = timing;
+}
+
+timing_t hV_Board::b_getTiming()
+{
+    return b_timing;
+}
+
+bool hV_Board::b_calibrateTiming(bool (* check)(void), uint8_t margin)
+{
+    if ((check == 0) or (check() == false))
+    {
+        return false;
+    }
+
+    uint16_t * delays[] = { &b_timing.setup, &b_timing.phase, &b_timing.hold, &b_timing.slave };
+
+    for (uint16_t * delay : delays)
+    {
+        // Smallest safe value between 0 and the current one
+        uint16_t initial = *delay;
+        uint16_t safe = initial;
+        uint16_t low = 0;
+
+        while (low < safe)
+        {
+            uint16_t middle = low + (safe - low) / 2;
+            *delay = middle;
+
+            // Three consecutive passes required
+            bool flagPass = check() and check() and check();
+            if (flagPass)
+            {
+                safe = middle;
+            }
+            else
+            {
+                low = middle + 1;
+            }
+        }
+
+        // Margin, capped by the initial value
+        uint32_t value = safe + ((uint32_t)safe * margin + 99) / 100;
+        *delay = hV_HAL_min(value, (uint32_t)initial);
+    }
+
+    if (b_family <= FAMILY_LARGE)
+    {
+        h_timingCache.timing[b_family] = b_timing;
+        h_timingCache.flag[b_family] = true;
+    }
+    return true;
+}
+
+void hV_Board::b_waitTiming(uint16_t us)
+{
+    if (us > 0)
+    {
+        hV_HAL_delayMicroseconds(us);
+    }
 }
 
 void hV_Board::b_reset(uint32_t ms1, uint32_t ms2, uint32_t ms3, uint32_t ms4, uint32_t ms5)
 {
-    hV_HAL_delayMilliseconds(ms1); // Wait for power stabilisation
-    hV_HAL_GPIO_set(b_pin.panelReset); // RESET = HIGH
-    hV_HAL_delayMilliseconds(ms2);
+    b_resetTiming({ ms1, ms2, ms3, ms4, ms5 });
+}
+
+void hV_Board::b_reset(uint16_t cog)
+{
+    b_resetCOG = cog;
+    b_resetTiming(b_getResetProfile(cog));
+}
+
+resetTiming_t hV_Board::b_getResetProfile(uint16_t cog)
+{
+    uint8_t index = 0;
+    while ((h_resetProfile[index].cog != COG_NONE) and (h_resetProfile[index].cog != cog))
+    {
+        index++;
+    }
+    return h_resetProfile[index].timing;
+}
+
+void hV_Board::b_resetTiming(resetTiming_t timing)
+{
+    if (not b_flagPowerWarm)
+    {
+        hV_HAL_delayMilliseconds(timing.power); // Wait for power stabilisation
+        hV_HAL_GPIO_set(b_pin.panelReset); // RESET = HIGH
+        hV_HAL_delayMilliseconds(timing.high);
+    }
+    // Warm reset: power stable and RESET already HIGH
+
     hV_HAL_GPIO_clear(b_pin.panelReset); // RESET = LOW
-    hV_HAL_delayMilliseconds(ms3);
+    hV_HAL_delayMilliseconds(timing.low);
     hV_HAL_GPIO_set(b_pin.panelReset); // RESET = HIGH
-    hV_HAL_delayMilliseconds(ms4);
+    hV_HAL_delayMilliseconds(timing.ready);
     hV_HAL_GPIO_set(b_pin.panelCS); // CS = HIGH, unselect
-    hV_HAL_delayMilliseconds(ms5);
+    hV_HAL_delayMilliseconds(timing.unselect);
+
+    b_flagPowerWarm = true;
+}
+
+bool hV_Board::b_waitBusy(bool state)
+{
+    uint8_t status = hV_HAL_GPIO_waitForTimeout(b_pin.panelBusy, state, b_timeoutBusy, b_flagSleepBusy);
+    b_markActivity();
+    return (status == WAIT_DONE);
 }
 
-void hV_Board::b_waitBusy(bool state)
+void hV_Board::b_setWaitBusy(uint32_t timeout, bool flagSleep)
 {
-    hV_HAL_GPIO_waitFor(b_pin.panelBusy, state); // non-blocking
+    b_timeoutBusy = timeout;
+    b_flagSleepBusy = flagSleep;
 }
 
 void hV_Board::b_suspend()
@@ -65,6 +238,7 @@ void hV_Board::b_suspend()
         if (b_pin.panelPower != NOT_CONNECTED) // generic
         {
             hV_HAL_GPIO_clear(b_pin.panelPower);
+            b_flagPowerWarm = false;
         }
         b_fsmPowerScreen &= ~FSM_GPIO_MASK;
     }
@@ -76,144 +250,224 @@ void hV_Board::b_resume()
     // Source FSM_SLEEP -> FSM_SLEEP
     //        FSM_OFF   -> FSM_SLEEP
 
-    if ((b_fsmPowerScreen & FSM_GPIO_MASK) != FSM_GPIO_MASK)
+    if ((b_fsmPowerScreen & FSM_BUS_MASK) != FSM_BUS_MASK)
     {
-        // Initialise GPIO expander
-        hV_HAL_GPIO_begin();
-
-        // Optional power circuit
-        if (b_pin.panelPower != NOT_CONNECTED) // generic
+        // Bus ended by b_checkIdle(), restarted with the same profiles
+        if (b_busSpeed[SPI_PROFILE_COMMAND] > 0)
         {
-            hV_HAL_GPIO_define(b_pin.panelPower, OUTPUT);
-            hV_HAL_GPIO_set(b_pin.panelPower);
+            hV_HAL_SPI_begin(b_busSpeed[SPI_PROFILE_COMMAND]);
+            for (uint8_t profile = 0; profile < SPI_PROFILE_NUMBER; profile++)
+            {
+                hV_HAL_SPI_setProfile(profile, b_busSpeed[profile]);
+            }
+            b_busSpeed[SPI_PROFILE_COMMAND] = 0;
         }
+        b_fsmPowerScreen |= FSM_BUS_MASK;
+    }
 
-        // Configure GPIOs
-        hV_HAL_GPIO_define(b_pin.panelBusy, INPUT);
-
-        hV_HAL_GPIO_define(b_pin.panelDC, OUTPUT);
-        hV_HAL_GPIO_set(b_pin.panelDC);
-
-        hV_HAL_GPIO_define(b_pin.panelReset, OUTPUT);
-        hV_HAL_GPIO_set(b_pin.panelReset);
-
-        hV_HAL_GPIO_define(b_pin.panelCS, OUTPUT);
-        hV_HAL_GPIO_set(b_pin.panelCS); // CS# = 1
-
-        if (b_pin.panelCSS != NOT_CONNECTED) // generic
+    if ((b_fsmPowerScreen & FSM_GPIO_MASK) != FSM_GPIO_MASK)
+    {
+        if (b_planNumber == 0)
         {
-            hV_HAL_GPIO_define(b_pin.panelCSS, OUTPUT);
-            hV_HAL_GPIO_set(b_pin.panelCSS);
+            b_recordPlan();
         }
 
-        // External SPI memory
-        if (b_pin.flashCS != NOT_CONNECTED) // generic
+        if (b_flagGpioLost)
         {
-            hV_HAL_GPIO_define(b_pin.flashCS, OUTPUT);
-            hV_HAL_GPIO_set(b_pin.flashCS);
+            // Initialise GPIO expander
+            hV_HAL_GPIO_begin();
+
+            // Configure GPIOs
+            for (uint8_t step = 0; step < b_planNumber; step++)
+            {
+                hV_HAL_GPIO_define(b_plan[step].pin, b_plan[step].mode);
+                if (b_plan[step].level != GPIO_LEVEL_NONE)
+                {
+                    hV_HAL_GPIO_write(b_plan[step].pin, b_plan[step].level);
+                }
+            }
+            b_flagGpioLost = false;
         }
-        if (b_pin.flashCSS != NOT_CONNECTED) // generic
+        else
         {
-            hV_HAL_GPIO_define(b_pin.flashCSS, OUTPUT);
-            hV_HAL_GPIO_set(b_pin.flashCSS);
+            // Configuration retained, only power turned off by b_suspend()
+            if (b_pin.panelPower != NOT_CONNECTED) // generic
+            {
+                hV_HAL_GPIO_set(b_pin.panelPower);
+            }
         }
 
-        // External SD card
-        if (b_pin.cardCS != NOT_CONNECTED) // generic
-        {
-            hV_HAL_GPIO_define(b_pin.cardCS, OUTPUT);
-            hV_HAL_GPIO_set(b_pin.cardCS);
-        }
-        if (b_pin.cardDetect != NOT_CONNECTED) // generic
+        b_fsmPowerScreen |= FSM_GPIO_MASK;
+    }
+    b_markActivity();
+}
+
+void hV_Board::b_setPowerProfile(uint8_t mode, uint8_t scope, uint32_t idle)
+{
+    b_suspendMode = mode;
+    b_suspendScope = scope;
+    b_idleTimeout = idle;
+    b_markActivity();
+}
+
+void hV_Board::b_markActivity()
+{
+    b_idleStart = hV_HAL_getMilliseconds();
+}
+
+bool hV_Board::b_checkIdle()
+{
+    if (b_suspendMode != POWER_MODE_AUTO)
+    {
+        return false;
+    }
+
+    if (((b_fsmPowerScreen & FSM_GPIO_MASK) != FSM_GPIO_MASK) or ((b_suspendScope & FSM_GPIO_MASK) != FSM_GPIO_MASK))
+    {
+        return false;
+    }
+
+    // Non-blocking update ongoing
+    if ((b_update.phase != UPDATE_PHASE_IDLE) and (b_update.phase < UPDATE_PHASE_DONE))
+    {
+        return false;
+    }
+
+    if ((uint32_t)(hV_HAL_getMilliseconds() - b_idleStart) < b_idleTimeout)
+    {
+        return false;
+    }
+
+    // Bus kept if another device holds it
+    if (((b_suspendScope & FSM_BUS_MASK) == FSM_BUS_MASK) and (hV_HAL_SPI_getOwner() == SPI_DEVICE_NONE))
+    {
+        // Profiles saved for b_resume()
+        for (uint8_t profile = 0; profile < SPI_PROFILE_NUMBER; profile++)
         {
-            hV_HAL_GPIO_define(b_pin.cardCS, INPUT);
+            b_busSpeed[profile] = hV_HAL_SPI_getSpeed(profile);
         }
+        hV_HAL_SPI_end();
+        b_fsmPowerScreen &= ~FSM_BUS_MASK;
+    }
+    b_suspend();
 
-        if (b_pin.scope == BOARD_EXT4)
-        {
-            if (b_pin.button != NOT_CONNECTED) // generic
-            {
-                hV_HAL_GPIO_define(b_pin.button, INPUT_PULLUP);
-            }
+    return true;
+}
 
-            if (b_pin.ledData != NOT_CONNECTED) // generic
-            {
-                hV_HAL_GPIO_define(b_pin.ledData, OUTPUT);
-            }
+void hV_Board::b_setGpioLost()
+{
+    b_flagGpioLost = true;
+    b_flagPowerWarm = false;
+}
 
-            if (b_pin.nfcFD != NOT_CONNECTED) // generic
-            {
-                hV_HAL_GPIO_define(b_pin.nfcFD, INPUT);
-            }
+void hV_Board::b_addStep(uint8_t pin, uint8_t mode, uint8_t level)
+{
+    if ((pin != NOT_CONNECTED) and (b_planNumber < GPIO_PLAN_LENGTH))
+    {
+        b_plan[b_planNumber] = { pin, mode, level };
+        b_planNumber++;
+    }
+}
 
-            if (b_pin.imuInt1 != NOT_CONNECTED) // generic
-            {
-                hV_HAL_GPIO_define(b_pin.imuInt1, INPUT);
-            }
+void hV_Board::b_recordPlan()
+{
+    b_planNumber = 0;
 
-            if (b_pin.imuInt2 != NOT_CONNECTED) // generic
-            {
-                hV_HAL_GPIO_define(b_pin.imuInt2, INPUT);
-            }
+    // Optional power circuit
+    b_addStep(b_pin.panelPower, OUTPUT, HIGH);
 
-            if (b_pin.weatherInt != NOT_CONNECTED) // generic
-            {
-                hV_HAL_GPIO_define(b_pin.weatherInt, INPUT);
-            }
-        } // BOARD_EXT4
+    // Panel
+    b_addStep(b_pin.panelBusy, INPUT, GPIO_LEVEL_NONE);
+    b_addStep(b_pin.panelDC, OUTPUT, HIGH);
+    b_addStep(b_pin.panelReset, OUTPUT, HIGH);
+    b_addStep(b_pin.panelCS, OUTPUT, HIGH); // CS# = 1
+    b_addStep(b_pin.panelCSS, OUTPUT, HIGH);
 
-        b_fsmPowerScreen |= FSM_GPIO_MASK;
-    }
+    // External SPI memory
+    b_addStep(b_pin.flashCS, OUTPUT, HIGH);
+    b_addStep(b_pin.flashCSS, OUTPUT, HIGH);
+
+    // External SD card
+    b_addStep(b_pin.cardCS, OUTPUT, HIGH);
+    b_addStep(b_pin.cardDetect, INPUT, GPIO_LEVEL_NONE);
+
+    if (b_pin.scope == BOARD_EXT4)
+    {
+        b_addStep(b_pin.button, INPUT_PULLUP, GPIO_LEVEL_NONE);
+        b_addStep(b_pin.ledData, OUTPUT, GPIO_LEVEL_NONE);
+        b_addStep(b_pin.nfcFD, INPUT, GPIO_LEVEL_NONE);
+        b_addStep(b_pin.imuInt1, INPUT, GPIO_LEVEL_NONE);
+        b_addStep(b_pin.imuInt2, INPUT, GPIO_LEVEL_NONE);
+        b_addStep(b_pin.weatherInt, INPUT, GPIO_LEVEL_NONE);
+    } // BOARD_EXT4
 }
 
 void hV_Board::b_sendIndexFixed(uint8_t index, uint8_t data, uint32_t size)
 {
+    if (b_flagAsync)
+    {
+        b_sendIndexDataWait();
+    }
+
+    hV_HAL_SPI_acquire(SPI_DEVICE_PANEL); // Shared bus
+
     hV_HAL_GPIO_clear(b_pin.panelDC); // DC Low = Command
     hV_HAL_GPIO_clear(b_pin.panelCS); // CS Low = Select
 
-    hV_HAL_delayMicroseconds(b_delayCS);
+    b_waitTiming(b_timing.setup);
     hV_HAL_SPI_transfer(index);
-    hV_HAL_delayMicroseconds(b_delayCS);
+    b_waitTiming(b_timing.phase);
 
     hV_HAL_GPIO_set(b_pin.panelDC); // DC High = Data
+    hV_HAL_SPI_selectProfile(SPI_PROFILE_DATA); // Bulk data clock
 
-    hV_HAL_delayMicroseconds(b_delayCS);
-    for (uint32_t i = 0; i < size; i++)
-    {
-        hV_HAL_SPI_transfer(data); // b_sendIndexFixed
-    }
-    hV_HAL_delayMicroseconds(b_delayCS);
+    b_waitTiming(b_timing.phase);
+    hV_HAL_SPI_writeFixed(data, size); // b_sendIndexFixed
+    b_waitTiming(b_timing.hold);
 
+    hV_HAL_SPI_selectProfile(SPI_PROFILE_COMMAND); // Command clock
     hV_HAL_GPIO_set(b_pin.panelCS); // CS High = Unselect
+
+    hV_HAL_SPI_release(SPI_DEVICE_PANEL); // Shared bus
 }
 
 void hV_Board::b_sendIndexFixedSelect(uint8_t index, uint8_t data, uint32_t size, uint8_t select)
 {
+    if (b_flagAsync)
+    {
+        b_sendIndexDataWait();
+    }
+
+    hV_HAL_SPI_acquire(SPI_DEVICE_PANEL); // Shared bus
+
     hV_HAL_GPIO_clear(b_pin.panelDC); // DC Low = Command
     b_select(select); // Select half of large screen
 
-    hV_HAL_delayMicroseconds(b_delayCS); // Longer delay for large screens
+    b_waitTiming(b_timing.setup);
     hV_HAL_SPI_transfer(index);
-    hV_HAL_delayMicroseconds(b_delayCS); // Longer delay for large screens
+    b_waitTiming(b_timing.phase);
 
     hV_HAL_GPIO_set(b_pin.panelDC); // DC High = Data
+    hV_HAL_SPI_selectProfile(SPI_PROFILE_DATA); // Bulk data clock
 
-    hV_HAL_delayMicroseconds(b_delayCS); // Longer delay for large screens
-    for (uint32_t i = 0; i < size; i++)
-    {
-        hV_HAL_SPI_transfer(data); // b_sendIndexFixed
-    }
-    hV_HAL_delayMicroseconds(b_delayCS); // Longer delay for large screens
+    b_waitTiming(b_timing.phase);
+    hV_HAL_SPI_writeFixed(data, size); // b_sendIndexFixed
+    b_waitTiming(b_timing.hold);
 
+    hV_HAL_SPI_selectProfile(SPI_PROFILE_COMMAND); // Command clock
     hV_HAL_GPIO_set(b_pin.panelCS); // CS High = Unselect Master
     if (b_pin.panelCSS != NOT_CONNECTED)
     {
         hV_HAL_GPIO_set(b_pin.panelCSS); // CSS High = Unselect Slave
     }
+
+    hV_HAL_SPI_release(SPI_DEVICE_PANEL); // Shared bus
 }
 
-void hV_Board::b_sendIndexData(uint8_t index, const uint8_t * data, uint32_t size)
+void hV_Board::b_openIndexData(uint8_t index)
 {
+    hV_HAL_SPI_acquire(SPI_DEVICE_PANEL); // Shared bus
+
     // Command mode
     hV_HAL_GPIO_clear(b_pin.panelDC); // DC Low = Command
 
@@ -222,60 +476,332 @@ void hV_Board::b_sendIndexData(uint8_t index, const uint8_t * data, uint32_t siz
     if (b_family == FAMILY_LARGE) // panelCSS already checked
     {
         hV_HAL_GPIO_clear(b_pin.panelCSS);
-        hV_HAL_delayMicroseconds(450); // 450 + 50 = 500
+        b_waitTiming(b_timing.slave);
     }
-    hV_HAL_delayMicroseconds(b_delayCS);
+    b_waitTiming(b_timing.setup);
 
     // Send command
     hV_HAL_SPI_transfer(index);
-    hV_HAL_delayMicroseconds(b_delayCS);
+    b_waitTiming(b_timing.phase);
 
     // Data mode
     hV_HAL_GPIO_set(b_pin.panelDC); // DC High = Data
+    hV_HAL_SPI_selectProfile(SPI_PROFILE_DATA); // Bulk data clock
 
-    hV_HAL_delayMicroseconds(b_delayCS);
-
-    // Send data
-    for (uint32_t i = 0; i < size; i++)
-    {
-        hV_HAL_SPI_transfer(data[i]);
-    }
+    b_waitTiming(b_timing.phase);
+}
 
+void hV_Board::b_closeIndexData()
+{
     // Unselect
-    hV_HAL_delayMicroseconds(b_delayCS);
+    hV_HAL_SPI_selectProfile(SPI_PROFILE_COMMAND); // Command clock
+    b_waitTiming(b_timing.hold);
     hV_HAL_GPIO_set(b_pin.panelCS); // CS High
     if (b_family == FAMILY_LARGE) // panelCSS already checked
     {
-        hV_HAL_delayMicroseconds(450); // 450 + 50 = 500
+        b_waitTiming(b_timing.slave);
         hV_HAL_GPIO_set(b_pin.panelCSS);
     }
-    hV_HAL_delayMicroseconds(b_delayCS);
+    b_waitTiming(b_timing.hold);
+
+    hV_HAL_SPI_release(SPI_DEVICE_PANEL); // Shared bus
+}
+
+void hV_Board::b_sendIndexData(uint8_t index, const uint8_t * data, uint32_t size)
+{
+    if (b_flagAsync)
+    {
+        b_sendIndexDataWait();
+    }
+
+    b_openIndexData(index);
+
+    // Send data
+    hV_HAL_SPI_writeBuffer(data, size);
+
+    b_closeIndexData();
+}
+
+void hV_Board::b_sendIndexData(uint8_t index, frameProducer_t producer, uint32_t size, uint8_t * buffer, uint32_t length, void * context)
+{
+    if ((producer == 0) or (buffer == 0) or (length == 0))
+    {
+        return;
+    }
+
+    if (b_flagAsync)
+    {
+        b_sendIndexDataWait();
+    }
+
+    b_openIndexData(index);
+
+    // Two halves, one filled while the other is transferred
+    bool flagDouble = (length > 1);
+    uint32_t half = flagDouble ? (length / 2) : length;
+    uint8_t current = 0;
+    uint32_t offset = 0;
+
+    while (offset < size)
+    {
+        uint8_t * chunk = &buffer[current * half];
+        uint32_t request = hV_HAL_min(half, size - offset);
+        uint32_t count = producer(chunk, offset, request, context);
+        if (count == 0)
+        {
+            break;
+        }
+        count = hV_HAL_min(count, request); // Not beyond the chunk
+
+        hV_HAL_SPI_writeAsync(chunk, count);
+        offset += count;
+
+        if (flagDouble)
+        {
+            current ^= 1;
+        }
+        else
+        {
+            hV_HAL_SPI_waitAsync(); // Single buffer reused
+        }
+    }
+
+    hV_HAL_SPI_waitAsync();
+    b_closeIndexData();
+}
+
+bool hV_Board::b_clipWindow(window_t & window, uint32_t size, uint16_t stride)
+{
+    if (stride == 0)
+    {
+        return false;
+    }
+
+    uint32_t columns = (uint32_t)stride * 8;
+    uint32_t rows = size / stride;
+
+    if ((window.dx == 0) or (window.dy == 0) or (window.x >= columns) or (window.y >= rows))
+    {
+        return false;
+    }
+
+    window.dx = hV_HAL_min((uint32_t)window.dx, columns - window.x);
+    window.dy = hV_HAL_min((uint32_t)window.dy, rows - window.y);
+    return true;
+}
+
+void hV_Board::b_sendIndexDataWindow(uint8_t index, const uint8_t * data, uint32_t size, uint16_t stride, window_t window)
+{
+    if (b_clipWindow(window, size, stride) == false)
+    {
+        return;
+    }
+
+    if (b_flagAsync)
+    {
+        b_sendIndexDataWait();
+    }
+
+    // Byte columns covering the window, within the row
+    uint16_t first = window.x / 8;
+    uint16_t last = ((uint32_t)window.x + window.dx - 1) / 8;
+    uint16_t length = last - first + 1;
+
+    b_openIndexData(index);
+
+    for (uint32_t row = window.y; row < (uint32_t)window.y + window.dy; row++)
+    {
+        hV_HAL_SPI_writeBuffer(&data[row * stride + first], length);
+    }
+
+    b_closeIndexData();
+}
+
+bool hV_Board::b_sendIndexStore(uint8_t index, hV_Frame_Store & store, uint8_t slot, uint8_t * buffer, uint32_t length)
+{
+    uint32_t size = store.getSize(slot);
+    if ((size == 0) or (buffer == 0) or (length == 0))
+    {
+        return false;
+    }
+
+    if (b_flagAsync)
+    {
+        b_sendIndexDataWait();
+    }
+
+    uint32_t offset = 0;
+    while (offset < size)
+    {
+        // Panel unselected and shared bus free while the flash reads
+        uint32_t count = store.readFrame(slot, offset, buffer, hV_HAL_min(length, size - offset));
+        if (count == 0)
+        {
+            break;
+        }
+
+        // Shared bus refused, nothing sent, panel already unselected
+        if (hV_HAL_SPI_acquire(SPI_DEVICE_PANEL) == SPI_DEVICE_REFUSED)
+        {
+            return false;
+        }
+
+        // Index sent again for each chunk, no assumption on the COG after a /CS toggle
+        b_openIndexData(index);
+        hV_HAL_SPI_writeBuffer(buffer, count);
+        b_closeIndexData();
+        hV_HAL_SPI_release(SPI_DEVICE_PANEL);
+
+        offset += count;
+    }
+
+    return (offset == size);
+}
+
+void hV_Board::b_sendIndexDataAsync(uint8_t index, const uint8_t * data, uint32_t size)
+{
+    if (b_flagAsync)
+    {
+        b_sendIndexDataWait();
+    }
+
+    b_openIndexData(index);
+
+    // Start sending data, returns during transfer if DMA available
+    hV_HAL_SPI_writeAsync(data, size);
+    b_flagAsync = true;
+}
+
+void hV_Board::b_sendIndexDataWait()
+{
+    if (b_flagAsync)
+    {
+        hV_HAL_SPI_waitAsync();
+        b_closeIndexData();
+        b_flagAsync = false;
+    }
 }
 
 // Software SPI Master protocol setup
 void hV_Board::b_sendIndexDataSelect(uint8_t index, const uint8_t * data, uint32_t size, uint8_t select)
 {
+    if (b_flagAsync)
+    {
+        b_sendIndexDataWait();
+    }
+
+    hV_HAL_SPI_acquire(SPI_DEVICE_PANEL); // Shared bus
+
     hV_HAL_GPIO_clear(b_pin.panelDC); // DC Low = Command
     b_select(select); // Select half of large screen
 
-    hV_HAL_delayMicroseconds(b_delayCS); // Longer delay for large screens
+    b_waitTiming(b_timing.setup);
     hV_HAL_SPI_transfer(index);
-    hV_HAL_delayMicroseconds(b_delayCS); // Longer delay for large screens
+    b_waitTiming(b_timing.phase);
 
     hV_HAL_GPIO_set(b_pin.panelDC); // DC High = Data
+    hV_HAL_SPI_selectProfile(SPI_PROFILE_DATA); // Bulk data clock
 
-    hV_HAL_delayMicroseconds(b_delayCS); // Longer delay for large screens
-    for (uint32_t i = 0; i < size; i++)
-    {
-        hV_HAL_SPI_transfer(data[i]);
-    }
-    hV_HAL_delayMicroseconds(b_delayCS); // Longer delay for large screens
+    b_waitTiming(b_timing.phase);
+    hV_HAL_SPI_writeBuffer(data, size);
+    b_waitTiming(b_timing.hold);
 
+    hV_HAL_SPI_selectProfile(SPI_PROFILE_COMMAND); // Command clock
     hV_HAL_GPIO_set(b_pin.panelCS); // CS High = Unselect Master
     if (b_pin.panelCSS != NOT_CONNECTED)
     {
         hV_HAL_GPIO_set(b_pin.panelCSS); // CSS High = Unselect Slave
     }
+
+    hV_HAL_SPI_release(SPI_DEVICE_PANEL); // Shared bus
+}
+
+void hV_Board::b_streamHalf(const uint8_t * data, uint32_t rows, uint16_t width, uint16_t offset, uint16_t length)
+{
+    uint8_t buffer[2][SPLIT_CHUNK_LENGTH];
+    uint8_t current = 0;
+    uint32_t row = 0;
+    uint16_t column = 0;
+
+    while (row < rows)
+    {
+        // Gather the next chunk while the previous one is transferred
+        uint16_t fill = 0;
+        while ((fill < SPLIT_CHUNK_LENGTH) and (row < rows))
+        {
+            uint16_t count = hV_HAL_min((uint16_t)(SPLIT_CHUNK_LENGTH - fill), (uint16_t)(length - column));
+            memcpy(&buffer[current][fill], &data[row * width + offset + column], count);
+            fill += count;
+            column += count;
+            if (column == length)
+            {
+                column = 0;
+                row += 1;
+            }
+        }
+
+        // Waits for the previous chunk before starting
+        hV_HAL_SPI_writeAsync(buffer[current], fill);
+        current ^= 1;
+    }
+
+    hV_HAL_SPI_waitAsync();
+}
+
+bool hV_Board::b_sendIndexDataSplit(uint8_t index, const uint8_t * data, uint32_t size, uint16_t width)
+{
+    if ((b_pin.panelCSS == NOT_CONNECTED) or (width < 2))
+    {
+        b_sendIndexData(index, data, size);
+        return true;
+    }
+
+    // Partial last row, not split between the halves
+    if ((size % width) != 0)
+    {
+        return false;
+    }
+
+    if (b_flagAsync)
+    {
+        b_sendIndexDataWait();
+    }
+
+    uint32_t rows = size / width;
+    uint16_t half = width / 2;
+    const uint8_t selects[2] = { PANEL_CS_MASTER, PANEL_CS_SLAVE };
+
+    hV_HAL_SPI_acquire(SPI_DEVICE_PANEL); // Shared bus, kept for both halves
+
+    for (uint8_t part = 0; part < 2; part++)
+    {
+        hV_HAL_GPIO_clear(b_pin.panelDC); // DC Low = Command
+        b_select(selects[part]); // Select half of large screen
+
+        b_waitTiming(b_timing.setup);
+        hV_HAL_SPI_transfer(index);
+        b_waitTiming(b_timing.phase);
+
+        hV_HAL_GPIO_set(b_pin.panelDC); // DC High = Data
+        hV_HAL_SPI_selectProfile(SPI_PROFILE_DATA); // Bulk data clock
+
+        b_waitTiming(b_timing.phase);
+        if (part == 0)
+        {
+            b_streamHalf(data, rows, width, 0, half);
+        }
+        else
+        {
+            b_streamHalf(data, rows, width, half, width - half);
+        }
+        b_waitTiming(b_timing.hold);
+
+        hV_HAL_SPI_selectProfile(SPI_PROFILE_COMMAND); // Command clock
+        b_unselect();
+    }
+
+    hV_HAL_SPI_release(SPI_DEVICE_PANEL); // Shared bus
+    return true;
 }
 
 void hV_Board::b_select(uint8_t select)
@@ -312,13 +838,20 @@ void hV_Board::b_select(uint8_t select)
 
     if (b_pin.panelCSS != NOT_CONNECTED)
     {
-        hV_HAL_delayMicroseconds(450); // 450 + 50 = 500
+        b_waitTiming(b_timing.slave);
     }
-    hV_HAL_delayMicroseconds(b_delayCS); // Longer delay for large screens
+    b_waitTiming(b_timing.setup);
 }
 
 void hV_Board::b_sendCommandDataSelect8(uint8_t command, uint8_t data, uint8_t select)
 {
+    if (b_flagAsync)
+    {
+        b_sendIndexDataWait();
+    }
+
+    hV_HAL_SPI_acquire(SPI_DEVICE_PANEL); // Shared bus
+
     hV_HAL_GPIO_clear(b_pin.panelDC); // LOW = command
     b_select(select); // Select half of large screen
 
@@ -332,20 +865,38 @@ void hV_Board::b_sendCommandDataSelect8(uint8_t command, uint8_t data, uint8_t s
     {
         hV_HAL_GPIO_set(b_pin.panelCSS);
     }
+
+    hV_HAL_SPI_release(SPI_DEVICE_PANEL); // Shared bus
 }
 
 void hV_Board::b_sendCommand8(uint8_t command)
 {
+    if (b_flagAsync)
+    {
+        b_sendIndexDataWait();
+    }
+
+    hV_HAL_SPI_acquire(SPI_DEVICE_PANEL); // Shared bus
+
     hV_HAL_GPIO_clear(b_pin.panelDC);
     hV_HAL_GPIO_clear(b_pin.panelCS);
 
     hV_HAL_SPI_transfer(command);
 
     hV_HAL_GPIO_set(b_pin.panelCS);
+
+    hV_HAL_SPI_release(SPI_DEVICE_PANEL); // Shared bus
 }
 
 void hV_Board::b_sendCommandData8(uint8_t command, uint8_t data)
 {
+    if (b_flagAsync)
+    {
+        b_sendIndexDataWait();
+    }
+
+    hV_HAL_SPI_acquire(SPI_DEVICE_PANEL); // Shared bus
+
     hV_HAL_GPIO_clear(b_pin.panelDC); // LOW = command
     hV_HAL_GPIO_clear(b_pin.panelCS);
 
@@ -355,5 +906,308 @@ void hV_Board::b_sendCommandData8(uint8_t command, uint8_t data)
     hV_HAL_SPI_transfer(data);
 
     hV_HAL_GPIO_set(b_pin.panelCS);
+
+    hV_HAL_SPI_release(SPI_DEVICE_PANEL); // Shared bus
+}
+
+void hV_Board::b_unselect()
+{
+    b_waitTiming(b_timing.hold);
+    hV_HAL_GPIO_set(b_pin.panelCS); // CS High = Unselect Master
+    if (b_pin.panelCSS != NOT_CONNECTED)
+    {
+        hV_HAL_GPIO_set(b_pin.panelCSS); // CSS High = Unselect Slave
+    }
 }
 
+void hV_Board::b_sequenceUnselect(sequence_t & state)
+{
+    if (state.flagSelected)
+    {
+        b_unselect();
+        state.flagSelected = false;
+    }
+}
+
+void hV_Board::b_sequenceSend(sequence_t & state, uint8_t index, const uint8_t * data, uint32_t length, bool flagTiming, bool flagStorage)
+{
+    hV_HAL_GPIO_clear(b_pin.panelDC); // DC Low = Command
+    if (state.flagSelected == false)
+    {
+        b_select(state.select); // Kept for the next steps
+        state.flagSelected = true;
+    }
+
+    hV_HAL_SPI_transfer(index);
+    if (flagTiming)
+    {
+        b_waitTiming(b_timing.phase);
+    }
+
+    hV_HAL_GPIO_set(b_pin.panelDC); // DC High = Data
+
+    if (length > 0)
+    {
+        if (flagTiming)
+        {
+            hV_HAL_SPI_selectProfile(SPI_PROFILE_DATA); // Bulk data clock
+            b_waitTiming(b_timing.phase);
+        }
+
+#if defined(__AVR__)
+
+        if (flagStorage)
+        {
+            // Data in flash, byte per byte
+            for (uint32_t offset = 0; offset < length; offset++)
+            {
+                hV_HAL_SPI_transfer(SEQUENCE_READ(data + offset));
+            }
+        }
+        else
+        {
+            hV_HAL_SPI_writeBuffer(data, length);
+        }
+
+#else
+
+        (void)flagStorage; // Same address space for flash and RAM
+        hV_HAL_SPI_writeBuffer(data, length);
+
+#endif // __AVR__
+
+        if (flagTiming)
+        {
+            hV_HAL_SPI_selectProfile(SPI_PROFILE_COMMAND); // Command clock
+        }
+    }
+}
+
+bool hV_Board::b_sequenceRun(sequence_t & state, bool flagBlocking)
+{
+    if (b_flagAsync)
+    {
+        b_sendIndexDataWait();
+    }
+
+    // Resume after delay or wait-busy
+    if (state.wait == SEQUENCE_PENDING_DELAY)
+    {
+        if (hV_HAL_getMilliseconds() - state.start < state.delay)
+        {
+            return false;
+        }
+        state.wait = SEQUENCE_PENDING_NONE;
+    }
+    else if (state.wait == SEQUENCE_PENDING_BUSY)
+    {
+        uint8_t status = hV_HAL_GPIO_checkWait();
+        if (status == WAIT_ONGOING)
+        {
+            return false;
+        }
+
+        state.wait = SEQUENCE_PENDING_NONE;
+        if (status == WAIT_TIMEOUT)
+        {
+            state.phase = UPDATE_PHASE_ERROR;
+            state.next = 0;
+            return true;
+        }
+    }
+
+    if (state.next == 0)
+    {
+        return true;
+    }
+
+    hV_HAL_SPI_acquire(SPI_DEVICE_PANEL); // Shared bus
+
+    bool flagEnd = false;
+    bool flagPause = false;
+    const uint8_t * sequence = state.next;
+
+    while ((flagEnd == false) and (flagPause == false))
+    {
+        uint8_t opcode = SEQUENCE_READ(sequence++);
+
+        switch (opcode)
+        {
+            case SEQUENCE_OPCODE_COMMAND:
+            case SEQUENCE_OPCODE_DATA:
+            {
+                uint8_t index = SEQUENCE_READ(sequence++);
+                uint8_t length = SEQUENCE_READ(sequence++);
+
+                b_sequenceSend(state, index, sequence, length, (opcode == SEQUENCE_OPCODE_DATA), true);
+                sequence += length;
+                break;
+            }
+
+            case SEQUENCE_OPCODE_FRAME:
+            {
+                uint8_t index = SEQUENCE_READ(sequence++);
+                uint8_t plane = SEQUENCE_READ(sequence++);
+
+                if ((state.planes != 0) and (plane < state.number))
+                {
+                    b_sequenceSend(state, index, state.planes[plane], state.size, true, false);
+                }
+                break;
+            }
+
+            case SEQUENCE_OPCODE_DELAY:
+            {
+                uint16_t ms = SEQUENCE_READ(sequence);
+                ms |= SEQUENCE_READ(sequence + 1) << 8;
+                sequence += 2;
+
+                b_sequenceUnselect(state);
+                if (flagBlocking)
+                {
+                    hV_HAL_delayMilliseconds(ms);
+                }
+                else
+                {
+                    state.start = hV_HAL_getMilliseconds();
+                    state.delay = ms;
+                    state.wait = SEQUENCE_PENDING_DELAY;
+                    flagPause = true;
+                }
+                break;
+            }
+
+            case SEQUENCE_OPCODE_WAIT_BUSY:
+            {
+                uint8_t value = SEQUENCE_READ(sequence++);
+
+                b_sequenceUnselect(state);
+                if (flagBlocking)
+                {
+                    if (b_waitBusy(value) == false)
+                    {
+                        state.phase = UPDATE_PHASE_ERROR;
+                        flagEnd = true;
+                    }
+                }
+                else
+                {
+                    hV_HAL_GPIO_startWait(b_pin.panelBusy, value, b_timeoutBusy);
+                    state.wait = SEQUENCE_PENDING_BUSY;
+                    flagPause = true;
+                }
+                break;
+            }
+
+            case SEQUENCE_OPCODE_SELECT:
+            {
+                uint8_t value = SEQUENCE_READ(sequence++);
+
+                if (value != state.select)
+                {
+                    b_sequenceUnselect(state);
+                }
+                state.select = value;
+                break;
+            }
+
+            case SEQUENCE_OPCODE_UNSELECT:
+
+                b_sequenceUnselect(state);
+                break;
+
+            case SEQUENCE_OPCODE_RESET:
+
+                // Profile of the COG, warm if power stayed on
+                b_sequenceUnselect(state);
+                b_reset(b_resetCOG);
+                break;
+
+            case SEQUENCE_OPCODE_PHASE:
+
+                state.phase = SEQUENCE_READ(sequence++);
+                break;
+
+            default: // SEQUENCE_OPCODE_END
+
+                flagEnd = true;
+                break;
+        }
+    }
+
+    if (flagEnd)
+    {
+        b_sequenceUnselect(state);
+        b_markActivity();
+        state.next = 0;
+        if (state.phase != UPDATE_PHASE_ERROR)
+        {
+            state.phase = UPDATE_PHASE_DONE;
+        }
+    }
+    else
+    {
+        state.next = sequence;
+    }
+
+    hV_HAL_SPI_release(SPI_DEVICE_PANEL); // Shared bus
+    return flagEnd;
+}
+
+void hV_Board::b_sequenceStart(sequence_t & state, const uint8_t * sequence, const uint8_t * const * planes, uint8_t number, uint32_t size)
+{
+    state.next = sequence;
+    state.planes = planes;
+    state.number = number;
+    state.size = size;
+    state.start = 0;
+    state.delay = 0;
+    state.select = (b_family == FAMILY_LARGE) ? PANEL_CS_BOTH : PANEL_CS_MASTER;
+    state.flagSelected = false;
+    state.phase = UPDATE_PHASE_IDLE;
+    state.wait = SEQUENCE_PENDING_NONE;
+}
+
+void hV_Board::b_sendSequence(const uint8_t * sequence)
+{
+    sequence_t state;
+
+    b_sequenceStart(state, sequence, 0, 0, 0);
+    b_sequenceRun(state, true);
+}
+
+void hV_Board::b_startUpdate(const uint8_t * sequence, const uint8_t * const * planes, uint8_t number, uint32_t size)
+{
+    b_sequenceStart(b_update, sequence, planes, number, size);
+}
+
+uint8_t hV_Board::b_stepUpdate()
+{
+    b_sequenceRun(b_update, false);
+    return b_update.phase;
+}
+
+uint8_t hV_Board::b_getUpdatePhase()
+{
+    return b_update.phase;
+}
+
+uint32_t hV_Board::b_getUpdateDue()
+{
+    switch (b_update.wait)
+    {
+        case SEQUENCE_PENDING_DELAY:
+        {
+            uint32_t elapsed = hV_HAL_getMilliseconds() - b_update.start;
+            return (elapsed < b_update.delay) ? (b_update.delay - elapsed) : 0;
+        }
+
+        case SEQUENCE_PENDING_BUSY:
+
+            return UPDATE_DUE_BUSY;
+
+        default:
+
+            return 0;
+    }
+}
@@ -7,8 +7,8 @@
 ///
 /// * Edition: Advanced
 ///
-/// @date 21 Nov 2025
-/// @version 1000
+/// @date 17 Oct 2026
+/// @version 1001
 ///
 /// @copyright (c) Pervasive Displays Inc., 2021-2025
 /// @copyright (c) Etigues, 2010-2025
@@ -37,8 +37,8 @@
 // SDK
 #include "hV_HAL_Peripherals.h"
 
-#if (hV_HAL_PERIPHERALS_RELEASE < 1000)
-#error Required hV_HAL_PERIPHERALS_RELEASE 1000
+#if (hV_HAL_PERIPHERALS_RELEASE < 1002)
+#error Required hV_HAL_PERIPHERALS_RELEASE 1002
 #endif // hV_HAL_PERIPHERALS_RELEASE
 
 // Boards
@@ -55,11 +55,211 @@
 #error Required hV_LIST_CONSTANTS_RELEASE 1000
 #endif // hV_LIST_CONSTANTS_RELEASE
 
+// Frame store
+#include "hV_Frame_Store.h"
+
+#if (hV_FRAME_STORE_RELEASE < 1000)
+#error Required hV_FRAME_STORE_RELEASE 1000
+#endif // hV_FRAME_STORE_RELEASE
+
 #ifndef hV_BOARD_RELEASE
 ///
 /// @brief Library release number
 ///
-#define hV_BOARD_RELEASE 1000
+#define hV_BOARD_RELEASE 1001
+
+///
+/// @brief Size of the chunks for split send
+/// @note Two chunks on the stack, one transferred while the other is prepared
+///
+#ifndef SPLIT_CHUNK_LENGTH
+#define SPLIT_CHUNK_LENGTH 256
+#endif // SPLIT_CHUNK_LENGTH
+
+///
+/// @brief Producer of frame chunks
+/// @param[out] buffer chunk to fill
+/// @param[in] offset position of the chunk in the frame, bytes
+/// @param[in] size maximum number of bytes
+/// @param context caller state, for example a decompressor
+/// @return number of bytes filled, 0 = end of data
+/// @note For frames generated, decompressed or read from storage
+/// @note Count above size clamped to size
+///
+typedef uint32_t (* frameProducer_t)(uint8_t * buffer, uint32_t offset, uint32_t size, void * context);
+
+///
+/// @brief Window of a frame
+/// @note Columns in pixels, rounded to whole bytes when sent
+///
+struct window_t
+{
+    uint16_t x; ///< first column, pixels
+    uint16_t y; ///< first row
+    uint16_t dx; ///< number of columns, pixels
+    uint16_t dy; ///< number of rows
+};
+
+///
+/// @brief Reset timing profile
+/// @note All values in ms
+///
+struct resetTiming_t
+{
+    uint32_t power; ///< delay for power stabilisation
+    uint32_t high; ///< delay after RESET HIGH
+    uint32_t low; ///< delay after RESET LOW
+    uint32_t ready; ///< delay after RESET HIGH
+    uint32_t unselect; ///< delay after CS_PIN and CSS_PIN HIGH
+};
+
+///
+/// @brief Number of steps of the GPIO configuration plan
+///
+#define GPIO_PLAN_LENGTH 16
+
+///
+/// @brief No level for input pin
+///
+#define GPIO_LEVEL_NONE 0xff
+
+///
+/// @brief Step of the GPIO configuration plan
+///
+struct gpioStep_t
+{
+    uint8_t pin; ///< pin
+    uint8_t mode; ///< INPUT, INPUT_PULLUP or OUTPUT
+    uint8_t level; ///< HIGH, LOW or GPIO_LEVEL_NONE
+};
+
+///
+/// @brief Timing profile for /CS and data/command
+/// @note All values in us
+///
+struct timing_t
+{
+    uint16_t setup; ///< /CS select to first byte
+    uint16_t phase; ///< command to data, before and after DC switch
+    uint16_t hold; ///< last byte to /CS unselect, and after unselect
+    uint16_t slave; ///< master /CS to slave /CSS edges, large screens only
+};
+
+///
+/// @name Command sequences
+/// @details Compact byte code run by b_sendSequence()
+/// @note Example
+/// @code {.cpp}
+/// static const uint8_t sequence[] SEQUENCE_STORAGE =
+/// {
+///     SEQUENCE_COMMAND(0x00, 0x0e), // Same as b_sendCommandData8(0x00, 0x0e)
+///     SEQUENCE_COMMAND(0xe5, 0x19), // /CS kept asserted
+///     SEQUENCE_DATA(0x10, 0x00, 0x00), // Same as b_sendIndexData(0x10, data, 2)
+///     SEQUENCE_INDEX(0x04), // Same as b_sendCommand8(0x04)
+///     SEQUENCE_WAIT_BUSY(HIGH), // /CS released before
+///     SEQUENCE_END
+/// };
+/// @endcode
+/// @{
+
+///
+/// @brief Storage of the sequences
+/// @note Flash on AVR, const data is already in flash on other platforms
+///
+#if defined(__AVR__)
+#include <avr/pgmspace.h>
+#define SEQUENCE_STORAGE PROGMEM
+#define SEQUENCE_READ(P) (pgm_read_byte(P))
+#else
+#define SEQUENCE_STORAGE
+#define SEQUENCE_READ(P) (*(P))
+#endif // __AVR__
+
+///
+/// @name Sequence operation codes
+/// @note Numbers are sequential and exclusive
+/// @{
+#define SEQUENCE_OPCODE_END 0x00 ///< End of sequence
+#define SEQUENCE_OPCODE_COMMAND 0x01 ///< index, length, data, without delays
+#define SEQUENCE_OPCODE_DATA 0x02 ///< index, length, data, with the timing profile and the data clock
+#define SEQUENCE_OPCODE_DELAY 0x03 ///< ms, low then high byte
+#define SEQUENCE_OPCODE_WAIT_BUSY 0x04 ///< state to reach
+#define SEQUENCE_OPCODE_SELECT 0x05 ///< PANEL_CS_MASTER, PANEL_CS_SLAVE or PANEL_CS_BOTH
+#define SEQUENCE_OPCODE_UNSELECT 0x06 ///< release /CS
+#define SEQUENCE_OPCODE_FRAME 0x07 ///< index, plane, with the timing profile and the data clock
+#define SEQUENCE_OPCODE_RESET 0x08 ///< reset with the profile of b_resetCOG, no argument
+#define SEQUENCE_OPCODE_PHASE 0x09 ///< UPDATE_PHASE_RESET to UPDATE_PHASE_STOP, reported by b_stepUpdate()
+/// @}
+
+///
+/// @brief Count the data bytes of a step
+/// @return number of arguments
+/// @note Evaluated at compile time
+///
+template <typename... T>
+constexpr uint8_t hV_Sequence_count(T...)
+{
+    return sizeof...(T);
+}
+
+#define SEQUENCE_END SEQUENCE_OPCODE_END ///< End of sequence
+#define SEQUENCE_INDEX(I) SEQUENCE_OPCODE_COMMAND, I, 0 ///< Command without data
+#define SEQUENCE_COMMAND(I, ...) SEQUENCE_OPCODE_COMMAND, I, hV_Sequence_count(__VA_ARGS__), __VA_ARGS__ ///< Command and data, without delays
+#define SEQUENCE_DATA(I, ...) SEQUENCE_OPCODE_DATA, I, hV_Sequence_count(__VA_ARGS__), __VA_ARGS__ ///< Command and data, with the timing profile
+#define SEQUENCE_DELAY(MS) SEQUENCE_OPCODE_DELAY, (uint8_t)((MS) & 0xff), (uint8_t)((MS) >> 8) ///< Delay in ms, up to 65535
+#define SEQUENCE_WAIT_BUSY(S) SEQUENCE_OPCODE_WAIT_BUSY, S ///< Wait for panelBusy to reach state
+#define SEQUENCE_SELECT(C) SEQUENCE_OPCODE_SELECT, C ///< Select sub-panels for the next steps
+#define SEQUENCE_UNSELECT SEQUENCE_OPCODE_UNSELECT ///< Release /CS before the next step
+#define SEQUENCE_FRAME(I, P) SEQUENCE_OPCODE_FRAME, I, P ///< Command and frame plane given to b_startUpdate()
+#define SEQUENCE_RESET SEQUENCE_OPCODE_RESET ///< Reset with b_reset(b_resetCOG), warm if power stayed on, blocking
+#define SEQUENCE_PHASE(P) SEQUENCE_OPCODE_PHASE, P ///< Mark the start of a phase
+/// @}
+
+///
+/// @name Phases of update
+/// @note Numbers are sequential and exclusive
+/// @{
+#define UPDATE_PHASE_IDLE 0x00 ///< No update started
+#define UPDATE_PHASE_RESET 0x01 ///< Reset and initialisation
+#define UPDATE_PHASE_SEND 0x02 ///< Frame planes sent
+#define UPDATE_PHASE_START 0x03 ///< DC/DC started and refresh triggered
+#define UPDATE_PHASE_REFRESH 0x04 ///< Refresh ongoing, panel busy
+#define UPDATE_PHASE_STOP 0x05 ///< DC/DC stopped
+#define UPDATE_PHASE_DONE 0x06 ///< Update completed
+#define UPDATE_PHASE_ERROR 0x07 ///< Update stopped by busy timeout
+/// @}
+
+///
+/// @brief Time until next action when waiting for panelBusy
+/// @note Next action triggered by the busy edge, call b_stepUpdate() at convenience
+///
+#define UPDATE_DUE_BUSY 0xffffffff
+
+///
+/// @name Pending waits of a sequence
+/// @note Numbers are sequential and exclusive
+/// @{
+#define SEQUENCE_PENDING_NONE 0x00 ///< Ready for next step
+#define SEQUENCE_PENDING_DELAY 0x01 ///< Delay ongoing
+#define SEQUENCE_PENDING_BUSY 0x02 ///< Waiting for panelBusy
+/// @}
+
+///
+/// @brief State of a running sequence
+///
+struct sequence_t
+{
+    const uint8_t * next; ///< next step, 0 = none
+    const uint8_t * const * planes; ///< frame planes for SEQUENCE_FRAME()
+    uint8_t number; ///< number of frame planes
+    uint32_t size; ///< number of bytes per frame plane
+    uint32_t start; ///< start of delay, ms
+    uint32_t delay; ///< duration of delay, ms
+    uint8_t select; ///< PANEL_CS_MASTER, PANEL_CS_SLAVE or PANEL_CS_BOTH
+    bool flagSelected; ///< true = /CS asserted
+    uint8_t phase; ///< UPDATE_PHASE_IDLE to UPDATE_PHASE_ERROR
+    uint8_t wait; ///< SEQUENCE_PENDING_NONE, SEQUENCE_PENDING_DELAY or SEQUENCE_PENDING_BUSY
+};
 
 // Objects
 //
@@ -86,11 +286,13 @@ class hV_Board
     /// @brief Initialisation
     /// @param board board configuration
     /// @param family screen family, default = FAMILY_SMALL
-    /// @param delayCS delay for /CS, default = 50 ms
+    /// @param delayCS delay for /CS, us, default = 50
     /// @note Typical values are
     /// + FAMILY_SMALL and 0 ms
     /// + FAMILY_MEDIUM and 50 ms
     /// + FAMILY_LARGE and 50 ms
+    /// @note Timing profile set from delayCS, 450 us for slave on FAMILY_LARGE or with panelCSS,
+    /// or from the cache if b_calibrateTiming() already ran for the family
     ///
     void b_begin(pins_t board, uint8_t family = FAMILY_SMALL, uint16_t delayCS = 50);
 
@@ -101,9 +303,26 @@ class hV_Board
     /// @param ms3 delay after RESET LOW, ms
     /// @param ms4 delay after RESET HIGH, ms
     /// @param ms5 delay after CS_PIN and CSS_PIN HIGH, ms
+    /// @note Warm reset if power stayed on since last reset
     ///
     void b_reset(uint32_t ms1, uint32_t ms2, uint32_t ms3, uint32_t ms4, uint32_t ms5);
 
+    ///
+    /// @brief Reset with the profile of the COG
+    /// @param cog COG identifier, for example COG_WIDE_SMALL
+    /// @note Warm reset if power stayed on since last reset
+    /// @note COG kept in b_resetCOG for SEQUENCE_RESET
+    ///
+    void b_reset(uint16_t cog);
+
+    ///
+    /// @brief Get the reset timing profile of a COG
+    /// @param cog COG identifier, for example COG_WIDE_SMALL
+    /// @return delays, ms
+    /// @note Conservative profile for unknown COG
+    ///
+    resetTiming_t b_getResetProfile(uint16_t cog);
+
     ///
     /// @brief Send fixed value through SPI
     /// @param index register
@@ -132,6 +351,41 @@ class hV_Board
     ///
     void b_sendIndexData(uint8_t index, const uint8_t * data, uint32_t size);
 
+    ///
+    /// @brief Send data from a producer through SPI
+    /// @param index register
+    /// @param producer function filling the chunks on demand
+    /// @param size number of bytes of the frame
+    /// @param buffer chunk buffer provided by the caller
+    /// @param length number of bytes of the buffer
+    /// @param context caller state passed to the producer, default 0
+    /// @note /CS kept asserted for the whole frame, RAM bounded by the buffer
+    /// @note Buffer split in two, one half filled while the other is transferred
+    /// * Single buffer if length = 1
+    /// @note Send stopped early if the producer returns 0
+    /// @note On large screens, sends to both sub-panels
+    ///
+    void b_sendIndexData(uint8_t index, frameProducer_t producer, uint32_t size, uint8_t * buffer, uint32_t length, void * context = 0);
+
+    ///
+    /// @brief Send a frame from the frame store through SPI
+    /// @param index register
+    /// @param store frame store, initialised
+    /// @param slot slot number
+    /// @param buffer bounce buffer provided by the caller
+    /// @param length number of bytes of the buffer
+    /// @return true if sent, false if the slot is empty or the shared bus is refused
+    /// @note Chunks read from flash into the buffer, then written to the panel
+    /// @note Panel unselected and shared bus released during each flash read
+    /// @note Index sent again before each chunk, within its own /CS frame
+    /// @note On large screens, sends to both sub-panels
+    /// @note Buffer of 4 KB or more recommended, each chunk costs one index and one /CS toggle
+    /// * plus the slave wait on large screens, 450 us
+    /// @warning COGs restarting the RAM address on the index require a buffer covering the frame,
+    /// or a RAM window set by the driver before each chunk
+    ///
+    bool b_sendIndexStore(uint8_t index, hV_Frame_Store & store, uint8_t slot, uint8_t * buffer, uint32_t length);
+
     ///
     /// @brief Send data through SPI to selected half of large screen
     /// @param index register
@@ -142,13 +396,78 @@ class hV_Board
     ///
     void b_sendIndexDataSelect(uint8_t index, const uint8_t * data, uint32_t size, uint8_t select = PANEL_CS_BOTH);
 
+    ///
+    /// @brief Send a window of a frame through SPI
+    /// @param index register
+    /// @param data full frame, row by row
+    /// @param size number of bytes of the full frame
+    /// @param stride number of bytes per row
+    /// @param window rectangle, in pixels
+    /// @note Only the rows and byte columns of the window are sent, in one selection
+    /// @note Window clipped to the frame with b_clipWindow(), nothing sent if empty
+    /// @note RAM window to be set on the COG before, with the driver commands
+    /// @warning Not for large screens
+    ///
+    void b_sendIndexDataWindow(uint8_t index, const uint8_t * data, uint32_t size, uint16_t stride, window_t window);
+
+    ///
+    /// @brief Clip a window to a frame
+    /// @param[in,out] window rectangle, in pixels
+    /// @param size number of bytes of the full frame
+    /// @param stride number of bytes per row
+    /// @return true if the clipped window is not empty
+    /// @note Frame of stride * 8 columns and size / stride rows
+    ///
+    bool b_clipWindow(window_t & window, uint32_t size, uint16_t stride);
+
+    ///
+    /// @brief Send a full-width frame to both halves of large screen
+    /// @param index register
+    /// @param data full-width frame, row by row
+    /// @param size number of bytes of the full frame
+    /// @param width number of bytes per full row
+    /// @return true if sent, false if size is not a multiple of width
+    /// @note First half of each row to master, second half to slave
+    /// @note One selection per half, rows gathered into chunks of SPLIT_CHUNK_LENGTH bytes
+    /// * Next chunk prepared during the asynchronous transfer of the current one
+    /// @note Same as b_sendIndexData() if panelCSS is not connected
+    /// @note Valid only for 9.7 and 12.20" screens
+    ///
+    bool b_sendIndexDataSplit(uint8_t index, const uint8_t * data, uint32_t size, uint16_t width);
+
+    ///
+    /// @brief Start sending data through SPI, asynchronous
+    /// @param index register
+    /// @param data data
+    /// @param size number of bytes
+    /// @note Same as b_sendIndexData() but returns during the transfer
+    /// @note Use the transfer time to prepare the next data, then call b_sendIndexDataWait()
+    /// @warning data must remain unchanged until b_sendIndexDataWait()
+    ///
+    void b_sendIndexDataAsync(uint8_t index, const uint8_t * data, uint32_t size);
+
+    ///
+    /// @brief Complete sending data started by b_sendIndexDataAsync()
+    /// @note Wait for the end of the transfer and unselect
+    ///
+    void b_sendIndexDataWait();
+
     ///
     /// @brief Wait for ready
     /// @details Wait for panelBusy signal to reach state
     /// @note Signal is busy until reaching state
     /// @param state to reach HIGH = default, LOW
+    /// @return true if reached, false on timeout
+    /// @note Edge-triggered with timeout and sleep set by b_setWaitBusy(), polling as fallback
     ///
-    void b_waitBusy(bool state = HIGH);
+    bool b_waitBusy(bool state = HIGH);
+
+    ///
+    /// @brief Configure the wait for ready
+    /// @param timeout maximum duration in ms, 0 = none = default
+    /// @param flagSleep true = MCU sleep during the wait, default = false
+    ///
+    void b_setWaitBusy(uint32_t timeout = 0, bool flagSleep = false);
 
     ///
     /// @brief Send a command
@@ -174,6 +493,82 @@ class hV_Board
     ///
     void b_sendCommandDataSelect8(uint8_t command, uint8_t data, uint8_t select = PANEL_CS_BOTH);
 
+    ///
+    /// @brief Run a command sequence
+    /// @param sequence sequence built with SEQUENCE_COMMAND(), SEQUENCE_DATA() and other steps, ending with SEQUENCE_END
+    /// @note Bus acquired once for the whole sequence
+    /// @note /CS kept asserted across consecutive command and data steps
+    /// * Released before delay, wait-busy and selection change, and at the end
+    /// @note Default selection is PANEL_CS_BOTH on FAMILY_LARGE, PANEL_CS_MASTER otherwise
+    /// @note Unknown operation code ends the sequence
+    /// @note Blocking, see b_startUpdate() for the non-blocking form
+    ///
+    void b_sendSequence(const uint8_t * sequence);
+
+    ///
+    /// @brief Start a non-blocking update
+    /// @param sequence update sequence, with SEQUENCE_PHASE() markers
+    /// @param planes frame planes for SEQUENCE_FRAME(), default = 0 = none
+    /// @param number number of frame planes, default = 0
+    /// @param size number of bytes per frame plane, default = 0
+    /// @note Nothing sent before the first call to b_stepUpdate()
+    /// @warning Planes must remain unchanged until UPDATE_PHASE_DONE
+    /// @code {.cpp}
+    /// b_startUpdate(sequenceUpdate, planes, 2, frameSize);
+    /// while (b_stepUpdate() < UPDATE_PHASE_DONE)
+    /// {
+    ///     // Other work, for up to b_getUpdateDue() ms
+    /// }
+    /// @endcode
+    ///
+    void b_startUpdate(const uint8_t * sequence, const uint8_t * const * planes = 0, uint8_t number = 0, uint32_t size = 0);
+
+    ///
+    /// @brief Advance the non-blocking update
+    /// @return current phase, UPDATE_PHASE_IDLE to UPDATE_PHASE_ERROR
+    /// @note Runs all the steps due, returns at the next delay or wait-busy step
+    /// @note Bus released between calls
+    ///
+    uint8_t b_stepUpdate();
+
+    ///
+    /// @brief Get the phase of the non-blocking update
+    /// @return UPDATE_PHASE_IDLE to UPDATE_PHASE_ERROR
+    ///
+    uint8_t b_getUpdatePhase();
+
+    ///
+    /// @brief Get the time until the next action of the non-blocking update
+    /// @return ms, 0 = now, UPDATE_DUE_BUSY = on panelBusy edge
+    ///
+    uint32_t b_getUpdateDue();
+
+    ///
+    /// @brief Set the timing profile
+    /// @param timing setup, phase, hold and slave delays, us
+    /// @note For example, a profile saved after b_calibrateTiming()
+    ///
+    void b_setTiming(timing_t timing);
+
+    ///
+    /// @brief Get the timing profile
+    /// @return setup, phase, hold and slave delays, us
+    ///
+    timing_t b_getTiming();
+
+    ///
+    /// @brief Find the smallest safe delays
+    /// @param check function sending a known sequence and checking the answer of the panel
+    /// @param margin safety margin in %, default = 25
+    /// @return true if calibrated, false if check fails with the current profile
+    /// @note Each delay reduced by dichotomy from the current value, with the others unchanged
+    /// @note Result cached per family and used by b_begin(), save with b_getTiming() for next boot
+    /// @note Offline on the host back-end, check() measures the bus timing with the recorder,
+    /// see extras/test/test_timing.cpp
+    /// @warning check() must return false on corruption, otherwise the delays reach 0
+    ///
+    bool b_calibrateTiming(bool (* check)(void), uint8_t margin = 25);
+
     ///
     /// @brief Suspend GPIOs
     /// @details Turn off and set low all GPIOs
@@ -183,13 +578,58 @@ class hV_Board
     ///
     /// @brief Resume GPIOs
     /// @details Turn on and configure all GPIOs
+    /// @note Configuration plan recorded at first call, then replayed
+    /// @note Only panelPower restored if the GPIO configuration is retained
+    /// @note SPI bus restarted if ended by b_checkIdle()
     ///
     void b_resume();
 
+    ///
+    /// @brief Set the power profile
+    /// @param mode POWER_MODE_MANUAL or POWER_MODE_AUTO
+    /// @param scope POWER_SCOPE_GPIO_ONLY or POWER_SCOPE_BUS_GPIO, default = POWER_SCOPE_GPIO_ONLY
+    /// @param idle idle time before suspend, ms, default = 0 = at first check
+    /// @note With POWER_MODE_AUTO, b_checkIdle() suspends after idle time
+    ///
+    void b_setPowerProfile(uint8_t mode, uint8_t scope = POWER_SCOPE_GPIO_ONLY, uint32_t idle = 0);
+
+    ///
+    /// @brief Restart the idle timer
+    /// @note Called at the end of b_waitBusy(), b_resume() and the non-blocking update
+    ///
+    void b_markActivity();
+
+    ///
+    /// @brief Suspend if idle for long enough
+    /// @return true if suspended
+    /// @note Call from an idle hook, for example loop()
+    /// @note Only with POWER_MODE_AUTO and no non-blocking update ongoing
+    /// @note POWER_SCOPE_BUS_GPIO ends the SPI bus only if no other device holds it,
+    /// next b_resume() restarts it with the same clock profiles
+    /// @warning POWER_SCOPE_BUS_GPIO ends the SPI bus, shared with the other devices
+    ///
+    bool b_checkIdle();
+
+    ///
+    /// @brief Mark the GPIO configuration as lost
+    /// @note For example, after deep sleep of the MCU
+    /// @note Next b_resume() replays the full configuration plan, next b_reset() is cold
+    ///
+    void b_setGpioLost();
+
     pins_t b_pin;
-    uint16_t b_delayCS = 50; // ms
+    timing_t b_timing = { 50, 50, 50, 0 }; // us
+    uint32_t b_timeoutBusy = 0; // ms, 0 = none
+    bool b_flagSleepBusy = false;
+    sequence_t b_update = {}; // non-blocking update
     uint8_t b_family;
     uint8_t b_fsmPowerScreen = FSM_OFF;
+    uint8_t b_suspendMode = POWER_MODE_MANUAL;
+    uint8_t b_suspendScope = POWER_SCOPE_GPIO_ONLY;
+    uint32_t b_idleTimeout = 0; // ms
+    uint32_t b_idleStart = 0; // ms
+    uint32_t b_busSpeed[SPI_PROFILE_NUMBER] = {}; // Hz, saved when b_checkIdle() ends the bus
+    uint16_t b_resetCOG = COG_NONE; // COG of the reset profile for SEQUENCE_RESET
 
   private:
 
@@ -199,6 +639,104 @@ class hV_Board
     ///
     void b_select(uint8_t select = PANEL_CS_BOTH);
 
+    ///
+    /// @brief Select and send register for data
+    /// @param index register
+    /// @note On large screens, selects both sub-panels
+    ///
+    void b_openIndexData(uint8_t index);
+
+    ///
+    /// @brief Unselect after data
+    ///
+    void b_closeIndexData();
+
+    ///
+    /// @brief Stream one half of a full-width frame
+    /// @param data full-width frame, row by row
+    /// @param rows number of rows
+    /// @param width number of bytes per full row
+    /// @param offset first byte of the half in each row
+    /// @param length number of bytes of the half in each row
+    /// @note Double-buffered gathering, overlapped with the asynchronous transfer
+    ///
+    void b_streamHalf(const uint8_t * data, uint32_t rows, uint16_t width, uint16_t offset, uint16_t length);
+
+    ///
+    /// @brief Prepare a sequence
+    /// @param[out] state state of the sequence
+    /// @param[in] sequence steps
+    /// @param[in] planes frame planes for SEQUENCE_FRAME()
+    /// @param[in] number number of frame planes
+    /// @param[in] size number of bytes per frame plane
+    ///
+    void b_sequenceStart(sequence_t & state, const uint8_t * sequence, const uint8_t * const * planes, uint8_t number, uint32_t size);
+
+    ///
+    /// @brief Run a sequence
+    /// @param state state of the sequence
+    /// @param flagBlocking true = delays and waits performed, false = return at delays and waits
+    /// @return true if the sequence is completed
+    ///
+    bool b_sequenceRun(sequence_t & state, bool flagBlocking);
+
+    ///
+    /// @brief Send a command and its data within a sequence
+    /// @param state state of the sequence, /CS asserted if needed
+    /// @param index register
+    /// @param data data
+    /// @param length number of bytes
+    /// @param flagTiming true = timing profile and data clock
+    /// @param flagStorage true = data in SEQUENCE_STORAGE
+    ///
+    void b_sequenceSend(sequence_t & state, uint8_t index, const uint8_t * data, uint32_t length, bool flagTiming, bool flagStorage);
+
+    ///
+    /// @brief Release /CS if asserted by the sequence
+    /// @param state state of the sequence
+    ///
+    void b_sequenceUnselect(sequence_t & state);
+
+    ///
+    /// @brief Unselect master and slave
+    /// @note With hold delay of the timing profile
+    ///
+    void b_unselect();
+
+    ///
+    /// @brief Wait for a timing delay
+    /// @param us delay, 0 = no wait
+    ///
+    void b_waitTiming(uint16_t us);
+
+    ///
+    /// @brief Reset with a timing profile
+    /// @param timing delays, ms
+    /// @note Warm reset without power stabilisation and first RESET HIGH delays
+    /// if power stayed on since last reset
+    ///
+    void b_resetTiming(resetTiming_t timing);
+
+    ///
+    /// @brief Record the GPIO configuration plan
+    /// @note Power first, then panel, external memory, SD-card and EXT4 pins
+    ///
+    void b_recordPlan();
+
+    ///
+    /// @brief Add a step to the GPIO configuration plan
+    /// @param pin pin, skipped if NOT_CONNECTED
+    /// @param mode INPUT, INPUT_PULLUP or OUTPUT
+    /// @param level HIGH, LOW or GPIO_LEVEL_NONE
+    ///
+    void b_addStep(uint8_t pin, uint8_t mode, uint8_t level);
+
+    bool b_flagAsync = false; // true = b_sendIndexDataAsync() ongoing
+    gpioStep_t b_plan[GPIO_PLAN_LENGTH];
+    uint8_t b_planNumber = 0; // 0 = not recorded
+    bool b_flagGpioLost = true; // true = full plan on next b_resume()
+    bool b_flagPowerWarm = false; // true = power on since last reset
+
     /// @endcond
 };
 
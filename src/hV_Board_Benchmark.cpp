@@ -0,0 +1,314 @@
+//
+// hV_Board_Benchmark.cpp
+// Library C++ code
+// ----------------------------------
+//
+// Project Pervasive Displays Library Suite
+// Based on highView technology
+//
+// Created by Rei Vilo, 17 Oct 2026
+//
+// Copyright (c) Pervasive Displays Inc., 2021-2025
+// Copyright (c) Etigues, 2010-2025
+// Licence All rights reserved
+// For exclusive use with Pervasive Displays screens
+//
+// Release 1000: Initial release
+//
+
+// Library header
+#include "hV_Board_Benchmark.h"
+
+#if defined(hV_HAL_HOST)
+
+#include <chrono>
+
+///
+/// @brief Frame sizes
+///
+struct h_size_t
+{
+    const char * name; ///< name of the constant
+    uint32_t size; ///< number of bytes
+};
+
+static const h_size_t h_sizes[] =
+{
+    { "frameSize_EPD_150", frameSize_EPD_150 },
+    { "frameSize_EPD_152", frameSize_EPD_152 },
+    { "frameSize_EPD_154", frameSize_EPD_154 },
+    { "frameSize_EPD_206", frameSize_EPD_206 },
+    { "frameSize_EPD_213", frameSize_EPD_213 },
+    { "frameSize_EPD_266", frameSize_EPD_266 },
+    { "frameSize_EPD_271", frameSize_EPD_271 },
+    { "frameSize_EPD_287", frameSize_EPD_287 },
+    { "frameSize_EPD_290", frameSize_EPD_290 },
+    { "frameSize_EPD_340", frameSize_EPD_340 },
+    { "frameSize_EPD_350", frameSize_EPD_350 },
+    { "frameSize_EPD_370", frameSize_EPD_370 },
+    { "frameSize_EPD_417", frameSize_EPD_417 },
+    { "frameSize_EPD_437", frameSize_EPD_437 },
+    { "frameSize_EPD_565", frameSize_EPD_565 },
+    { "frameSize_EPD_581", frameSize_EPD_581 },
+    { "frameSize_EPD_741", frameSize_EPD_741 },
+    { "frameSize_EPD_969", frameSize_EPD_969 },
+    { "frameSize_EPD_B98", frameSize_EPD_B98 },
+};
+
+///
+/// @name Functions measured
+/// @note Numbers are sequential and exclusive
+/// @{
+#define BENCHMARK_INDEX_DATA 0 ///< b_sendIndexData()
+#define BENCHMARK_INDEX_DATA_SELECT 1 ///< b_sendIndexDataSelect(), master then slave
+#define BENCHMARK_INDEX_FIXED 2 ///< b_sendIndexFixed()
+#define BENCHMARK_COMMAND 3 ///< b_sendCommand8(), b_sendCommandData8() and b_sendCommandDataSelect8()
+#define BENCHMARK_INDEX_DATA_BYTE 4 ///< Reference for b_sendIndexData(), hV_HAL_SPI_transfer() per byte
+#define BENCHMARK_NUMBER 5 ///< Number of functions
+/// @}
+
+static const char * h_functions[BENCHMARK_NUMBER] =
+{
+    "b_sendIndexData",
+    "b_sendIndexDataSelect",
+    "b_sendIndexFixed",
+    "b_sendCommand",
+    "reference_sendIndexData",
+};
+
+///
+/// @brief Number of runs per measure, fastest host time kept
+///
+#define BENCHMARK_REPEAT 5
+
+static const char * h_families[] = { "", "FAMILY_SMALL", "FAMILY_MEDIUM", "FAMILY_LARGE" };
+
+///
+/// @brief Board for benchmark
+/// @note Large screens require panelCSS
+///
+static const pins_t h_board = boardRaspberryPiPico_RP2040;
+
+hV_Board_Benchmark::hV_Board_Benchmark()
+{
+    ;
+}
+
+void hV_Board_Benchmark::_sendReference(uint8_t index, const uint8_t * data, uint32_t size)
+{
+    // Same selection and delays as b_sendIndexData()
+    hV_HAL_SPI_acquire(SPI_DEVICE_PANEL);
+    hV_HAL_GPIO_clear(b_pin.panelDC);
+    hV_HAL_GPIO_clear(b_pin.panelCS);
+    if (b_family == FAMILY_LARGE)
+    {
+        hV_HAL_GPIO_clear(b_pin.panelCSS);
+        hV_HAL_delayMicroseconds(b_timing.slave);
+    }
+    hV_HAL_delayMicroseconds(b_timing.setup);
+    hV_HAL_SPI_transfer(index);
+    hV_HAL_delayMicroseconds(b_timing.phase);
+    hV_HAL_GPIO_set(b_pin.panelDC);
+    hV_HAL_SPI_selectProfile(SPI_PROFILE_DATA);
+    hV_HAL_delayMicroseconds(b_timing.phase);
+
+    // Path before the buffer write, one call per byte
+    for (uint32_t offset = 0; offset < size; offset++)
+    {
+        hV_HAL_SPI_transfer(data[offset]);
+    }
+
+    hV_HAL_SPI_selectProfile(SPI_PROFILE_COMMAND);
+    hV_HAL_delayMicroseconds(b_timing.hold);
+    hV_HAL_GPIO_set(b_pin.panelCS);
+    if (b_family == FAMILY_LARGE)
+    {
+        hV_HAL_delayMicroseconds(b_timing.slave);
+        hV_HAL_GPIO_set(b_pin.panelCSS);
+    }
+    hV_HAL_delayMicroseconds(b_timing.hold);
+    hV_HAL_SPI_release(SPI_DEVICE_PANEL);
+}
+
+void hV_Board_Benchmark::_measure(uint8_t function, uint8_t size, uint8_t family)
+{
+    uint32_t length = h_sizes[size].size;
+
+    // Default delay for /CS, as set by the drivers
+    b_begin(h_board, family);
+    b_resume();
+    hV_HAL_SPI_begin();
+
+    uint64_t elapsed = 0;
+    uint64_t host = UINT64_MAX;
+    hostCounter_t counters = {};
+
+    for (uint8_t repeat = 0; repeat < BENCHMARK_REPEAT; repeat++)
+    {
+        hV_HAL_Host_clear();
+        uint64_t start = hV_HAL_Host_getMicroseconds();
+        auto chronoStart = std::chrono::steady_clock::now();
+
+        switch (function)
+        {
+            case BENCHMARK_INDEX_DATA:
+
+                b_sendIndexData(0x10, _frame.data(), length);
+                break;
+
+            case BENCHMARK_INDEX_DATA_SELECT:
+
+                b_sendIndexDataSelect(0x10, _frame.data(), length, PANEL_CS_MASTER);
+                b_sendIndexDataSelect(0x10, _frame.data(), length, PANEL_CS_SLAVE);
+                break;
+
+            case BENCHMARK_INDEX_FIXED:
+
+                b_sendIndexFixed(0x10, 0x00, length);
+                break;
+
+            case BENCHMARK_INDEX_DATA_BYTE:
+
+                _sendReference(0x10, _frame.data(), length);
+                break;
+
+            default: // BENCHMARK_COMMAND
+
+                // Same number of bytes as the frame, by pairs of command and data
+                for (uint32_t index = 0; index < length / 2; index++)
+                {
+                    switch (index % 3)
+                    {
+                        case 0:
+
+                            b_sendCommand8(0x00);
+                            b_sendCommand8(0x00);
+                            break;
+
+                        case 1:
+
+                            b_sendCommandData8(0x00, 0x00);
+                            break;
+
+                        default:
+
+                            b_sendCommandDataSelect8(0x00, 0x00);
+                            break;
+                    }
+                }
+                break;
+        }
+
+        auto chronoEnd = std::chrono::steady_clock::now();
+        counters = hV_HAL_Host_getCounters();
+        elapsed = hV_HAL_Host_getMicroseconds() - start;
+        host = hV_HAL_min(host, (uint64_t)std::chrono::duration_cast<std::chrono::nanoseconds>(chronoEnd - chronoStart).count());
+    }
+
+    benchmark_t result;
+    result.function = h_functions[function];
+    result.size = h_sizes[size].name;
+    result.family = h_families[family];
+    result.bytes = counters.spiByte;
+    result.calls = counters.spiCall;
+    result.elapsed = elapsed;
+    result.delay = counters.delay;
+    result.host = host;
+    _results.push_back(result);
+
+    hV_HAL_SPI_end();
+}
+
+uint16_t hV_Board_Benchmark::run(FILE * file)
+{
+    uint32_t sizeMax = 0;
+    for (const h_size_t & item : h_sizes)
+    {
+        sizeMax = hV_HAL_max(sizeMax, item.size);
+    }
+
+    _frame.assign(sizeMax, 0x00);
+    for (uint32_t index = 0; index < sizeMax; index++)
+    {
+        _frame[index] = index & 0xff;
+    }
+
+    _results.clear();
+    hV_HAL_Host_setRecording(false);
+
+    for (uint8_t function = 0; function < BENCHMARK_NUMBER; function++)
+    {
+        for (uint8_t size = 0; size < sizeof(h_sizes) / sizeof(h_sizes[0]); size++)
+        {
+            for (uint8_t family = FAMILY_SMALL; family <= FAMILY_LARGE; family++)
+            {
+                _measure(function, size, family);
+            }
+        }
+    }
+
+    hV_HAL_Host_setRecording(true);
+
+    if (file != 0)
+    {
+        _writeJSON(file);
+    }
+
+    return _results.size();
+}
+
+benchmark_t hV_Board_Benchmark::getResult(uint16_t index)
+{
+    return _results.at(index);
+}
+
+void hV_Board_Benchmark::_writeJSON(FILE * file)
+{
+    fprintf(file, "{\n\"release\": %i,\n\"results\": [\n", hV_BOARD_RELEASE);
+
+    for (size_t index = 0; index < _results.size(); index++)
+    {
+        const benchmark_t & result = _results[index];
+
+        double bus = (result.elapsed > 0) ? 1.0e6 * result.bytes / result.elapsed : 0.0;
+        double host = (result.host > 0) ? 1.0e9 * result.bytes / result.host : 0.0;
+        double calls = (result.bytes > 0) ? (double)result.calls / result.bytes : 0.0;
+
+        fprintf(file, "{\"function\": \"%s\", \"size\": \"%s\", \"family\": \"%s\", ", result.function, result.size, result.family);
+        fprintf(file, "\"bytes\": %u, \"busBytesPerSecond\": %.0f, \"hostBytesPerSecond\": %.0f, ", result.bytes, bus, host);
+        fprintf(file, "\"callsPerByte\": %.6f, \"delay_us\": %llu, \"elapsed_us\": %llu}%s\n",
+                calls, (unsigned long long)result.delay, (unsigned long long)result.elapsed,
+                (index + 1 < _results.size()) ? "," : "");
+    }
+
+    fprintf(file, "],\n\"gains\": [\n");
+
+    // Buffer write against the reference, one call per byte
+    bool flagFirst = true;
+    for (const benchmark_t & buffer : _results)
+    {
+        if (buffer.function != h_functions[BENCHMARK_INDEX_DATA])
+        {
+            continue;
+        }
+
+        for (const benchmark_t & reference : _results)
+        {
+            if ((reference.function == h_functions[BENCHMARK_INDEX_DATA_BYTE]) and (reference.size == buffer.size) and (reference.family == buffer.family))
+            {
+                double hostBuffer = (buffer.host > 0) ? 1.0e9 * buffer.bytes / buffer.host : 0.0;
+                double hostReference = (reference.host > 0) ? 1.0e9 * reference.bytes / reference.host : 0.0;
+                double ratio = (hostReference > 0) ? hostBuffer / hostReference : 0.0;
+
+                fprintf(file, "%s{\"size\": \"%s\", \"family\": \"%s\", ", flagFirst ? "" : ",\n", buffer.size, buffer.family);
+                fprintf(file, "\"bufferBytesPerSecond\": %.0f, \"referenceBytesPerSecond\": %.0f, \"ratio\": %.2f, ", hostBuffer, hostReference, ratio);
+                fprintf(file, "\"bufferCalls\": %u, \"referenceCalls\": %u}", buffer.calls, reference.calls);
+                flagFirst = false;
+            }
+        }
+    }
+
+    fprintf(file, "\n]\n}\n");
+}
+
+#endif // hV_HAL_HOST
@@ -0,0 +1,127 @@
+///
+/// @file hV_Board_Benchmark.h
+/// @brief Micro-benchmark of the board send functions on the host back-end
+///
+/// @details Project Pervasive Displays Library Suite
+/// @n Based on highView technology
+///
+/// @date 17 Oct 2026
+/// @version 1000
+///
+/// @copyright (c) Pervasive Displays Inc., 2021-2025
+/// @copyright (c) Etigues, 2010-2025
+/// @copyright All rights reserved
+/// @copyright For exclusive use with Pervasive Displays screens
+///
+/// * Basic edition: for hobbyists and for basic usage
+/// @n Creative Commons Attribution-ShareAlike 4.0 International (CC BY-SA 4.0)
+/// @see https://creativecommons.org/licenses/by-sa/4.0/
+///
+/// @n Consider the Evaluation or Commercial editions for professionals or organisations and for commercial usage
+///
+/// * Evaluation edition: for professionals or organisations, evaluation only, no commercial usage
+/// @n All rights reserved
+///
+/// * Commercial edition: for professionals or organisations, commercial usage
+/// @n All rights reserved
+///
+/// * Viewer edition: for professionals or organisations
+/// @n All rights reserved
+///
+/// * Documentation
+/// @n All rights reserved
+///
+/// @note Host back-end only, executable and target benchmark in CMakeLists.txt
+/// @code {.cpp}
+/// #include "hV_Board_Benchmark.h"
+///
+/// int main()
+/// {
+///     hV_Board_Benchmark benchmark;
+///     benchmark.run(stdout);
+/// }
+/// @endcode
+///
+
+// Board
+#include "hV_Board.h"
+
+#if (hV_BOARD_RELEASE < 1001)
+#error Required hV_BOARD_RELEASE 1001
+#endif // hV_BOARD_RELEASE
+
+#ifndef hV_BOARD_BENCHMARK_RELEASE
+///
+/// @brief Library release number
+///
+#define hV_BOARD_BENCHMARK_RELEASE 1000
+
+#if defined(hV_HAL_HOST)
+
+///
+/// @brief Result of one benchmark
+///
+struct benchmark_t
+{
+    const char * function; ///< name of the function
+    const char * size; ///< name of the frame size
+    const char * family; ///< name of the family
+    uint32_t bytes; ///< number of bytes on SPI
+    uint32_t calls; ///< number of calls to SPI.transfer()
+    uint64_t elapsed; ///< simulated time, us
+    uint64_t delay; ///< modelled delays, us
+    uint64_t host; ///< host time, ns
+};
+
+///
+/// @brief Micro-benchmark of the board send functions
+/// @details For each frameSize_EPD_* and FAMILY_SMALL, FAMILY_MEDIUM and FAMILY_LARGE
+/// * b_sendIndexData()
+/// * b_sendIndexDataSelect()
+/// * b_sendIndexFixed()
+/// * b_sendCommand8(), b_sendCommandData8() and b_sendCommandDataSelect8()
+/// * Reference for b_sendIndexData(), same planes with hV_HAL_SPI_transfer() per byte
+///
+/// Reported values
+/// * bytes per second, simulated bus and host, fastest of BENCHMARK_REPEAT runs
+/// * calls per byte
+/// * modelled delays, including the setup, phase, hold and slave delays of the timing profile
+/// * gains, b_sendIndexData() against the reference: host bytes per second of both, ratio and calls
+/// @note Simulated bus time independent of the number of calls, gain measured on the host time
+///
+class hV_Board_Benchmark: public hV_Board
+{
+  public:
+
+    ///
+    /// @brief Constructor
+    ///
+    hV_Board_Benchmark();
+
+    ///
+    /// @brief Run all the benchmarks
+    /// @param file output file for the JSON report, default = 0 = none
+    /// @return number of results
+    ///
+    uint16_t run(FILE * file = 0);
+
+    ///
+    /// @brief Get a result
+    /// @param index 0..number of results - 1
+    /// @return result
+    ///
+    benchmark_t getResult(uint16_t index);
+
+  private:
+
+    void _measure(uint8_t function, uint8_t size, uint8_t family);
+    void _sendReference(uint8_t index, const uint8_t * data, uint32_t size);
+    void _writeJSON(FILE * file);
+
+    std::vector<benchmark_t> _results;
+    std::vector<uint8_t> _frame;
+};
+
+#endif // hV_HAL_HOST
+
+#endif // hV_BOARD_BENCHMARK_RELEASE
@@ -0,0 +1,277 @@
+//
+// hV_Frame_Store.cpp
+// Library C++ code
+// ----------------------------------
+//
+// Project Pervasive Displays Library Suite
+// Based on highView technology
+//
+// Created by Rei Vilo, 17 Oct 2026
+//
+// Copyright (c) Pervasive Displays Inc., 2021-2025
+// Copyright (c) Etigues, 2010-2025
+// Licence All rights reserved
+// For exclusive use with Pervasive Displays screens
+//
+// Release 1000: Initial release
+//
+
+// Library header
+#include "hV_Frame_Store.h"
+
+///
+/// @name SPI flash commands
+/// @{
+#define FLASH_READ 0x03 ///< Read data
+#define FLASH_PROGRAM 0x02 ///< Page program
+#define FLASH_ERASE 0x20 ///< Sector erase, 4 KB
+#define FLASH_WRITE_ENABLE 0x06 ///< Write enable
+#define FLASH_STATUS 0x05 ///< Read status register 1
+#define FLASH_IDENTIFIER 0x9f ///< JEDEC identifier
+#define FLASH_WAKE_UP 0xab ///< Release from deep power-down
+/// @}
+
+#define FLASH_STATUS_BUSY 0x01 ///< Write in progress
+#define FLASH_TIMEOUT 1000 ///< Maximum erase or program duration, ms
+
+#define STORE_MAGIC 0x53467668 ///< "hvFS", valid slot
+
+hV_Frame_Store::hV_Frame_Store()
+{
+    _flagReady = false;
+}
+
+bool hV_Frame_Store::begin(uint8_t pinCS, uint32_t frameSize, uint32_t base, uint32_t speed, uint8_t slots)
+{
+    hV_HAL_SPI_defineDevice(SPI_DEVICE_FLASH, pinCS, speed, SPI_MODE0);
+
+    _base = base;
+    _frameSize = frameSize;
+    _slots = slots;
+    _slotSize = STORE_HEADER_LENGTH + frameSize;
+    _slotSize = ((_slotSize + FLASH_SECTOR_LENGTH - 1) / FLASH_SECTOR_LENGTH) * FLASH_SECTOR_LENGTH;
+
+    // Flash may be in deep power-down
+    if (_command(FLASH_WAKE_UP, 0, false))
+    {
+        hV_HAL_SPI_release(SPI_DEVICE_FLASH);
+    }
+    hV_HAL_delayMicroseconds(50);
+
+    uint32_t identifier = getIdentifier();
+    _flagReady = (identifier != 0x000000) and (identifier != 0xffffff);
+
+    // Capacity = 2^code bytes, 3-byte addresses up to 16 MB
+    uint8_t code = identifier & 0xff;
+    uint32_t capacity = (code < 24) ? ((uint32_t)1 << code) : ((uint32_t)1 << 24);
+    uint64_t end = (uint64_t)_base + (uint64_t)_slots * _slotSize;
+    _flagReady = _flagReady and (_slots > 0) and (end <= capacity);
+
+    return _flagReady;
+}
+
+uint32_t hV_Frame_Store::getIdentifier()
+{
+    if (_command(FLASH_IDENTIFIER, 0, false) == false)
+    {
+        return 0;
+    }
+    uint32_t identifier = hV_HAL_SPI_transfer(0x00);
+    identifier = (identifier << 8) | hV_HAL_SPI_transfer(0x00);
+    identifier = (identifier << 8) | hV_HAL_SPI_transfer(0x00);
+    hV_HAL_SPI_release(SPI_DEVICE_FLASH);
+
+    return identifier;
+}
+
+uint32_t hV_Frame_Store::_address(uint8_t slot)
+{
+    return _base + (uint32_t)slot * _slotSize;
+}
+
+bool hV_Frame_Store::_command(uint8_t command, uint32_t address, bool flagAddress)
+{
+    if (hV_HAL_SPI_acquire(SPI_DEVICE_FLASH) == SPI_DEVICE_REFUSED) // Shared bus, /CS selected
+    {
+        return false;
+    }
+
+    hV_HAL_SPI_transfer(command);
+    if (flagAddress)
+    {
+        hV_HAL_SPI_transfer((address >> 16) & 0xff);
+        hV_HAL_SPI_transfer((address >> 8) & 0xff);
+        hV_HAL_SPI_transfer(address & 0xff);
+    }
+    // Released by the caller
+    return true;
+}
+
+bool hV_Frame_Store::_waitReady()
+{
+    uint32_t start = hV_HAL_getMilliseconds();
+
+    while (true)
+    {
+        if (_command(FLASH_STATUS, 0, false) == false)
+        {
+            return false;
+        }
+        uint8_t status = hV_HAL_SPI_transfer(0x00);
+        hV_HAL_SPI_release(SPI_DEVICE_FLASH);
+
+        if ((status & FLASH_STATUS_BUSY) == 0)
+        {
+            return true;
+        }
+        if (hV_HAL_getMilliseconds() - start > FLASH_TIMEOUT)
+        {
+            return false;
+        }
+        hV_HAL_delayMilliseconds(1);
+    }
+}
+
+bool hV_Frame_Store::_read(uint32_t address, uint8_t * data, uint32_t size)
+{
+    if (_command(FLASH_READ, address, true) == false)
+    {
+        return false;
+    }
+    hV_HAL_SPI_readBuffer(data, size);
+    hV_HAL_SPI_release(SPI_DEVICE_FLASH);
+    return true;
+}
+
+bool hV_Frame_Store::_program(uint32_t address, const uint8_t * data, uint32_t size)
+{
+    while (size > 0)
+    {
+        // Page boundary not crossed
+        uint32_t length = hV_HAL_min(size, FLASH_PAGE_LENGTH - (address % FLASH_PAGE_LENGTH));
+
+        if (_command(FLASH_WRITE_ENABLE, 0, false) == false)
+        {
+            return false;
+        }
+        hV_HAL_SPI_release(SPI_DEVICE_FLASH);
+
+        if (_command(FLASH_PROGRAM, address, true) == false)
+        {
+            return false;
+        }
+        hV_HAL_SPI_writeBuffer(data, length);
+        hV_HAL_SPI_release(SPI_DEVICE_FLASH);
+
+        if (_waitReady() == false)
+        {
+            return false;
+        }
+
+        address += length;
+        data += length;
+        size -= length;
+    }
+    return true;
+}
+
+bool hV_Frame_Store::eraseFrame(uint8_t slot)
+{
+    if ((_flagReady == false) or (slot >= _slots))
+    {
+        return false;
+    }
+
+    uint32_t address = _address(slot);
+    for (uint32_t offset = 0; offset < _slotSize; offset += FLASH_SECTOR_LENGTH)
+    {
+        if (_command(FLASH_WRITE_ENABLE, 0, false) == false)
+        {
+            return false;
+        }
+        hV_HAL_SPI_release(SPI_DEVICE_FLASH);
+
+        if (_command(FLASH_ERASE, address + offset, true) == false)
+        {
+            return false;
+        }
+        hV_HAL_SPI_release(SPI_DEVICE_FLASH);
+
+        if (_waitReady() == false)
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+bool hV_Frame_Store::writeFrame(uint8_t slot, uint32_t offset, const uint8_t * data, uint32_t size)
+{
+    if ((_flagReady == false) or (slot >= _slots) or (offset + size > _frameSize))
+    {
+        return false;
+    }
+
+    return _program(_address(slot) + STORE_HEADER_LENGTH + offset, data, size);
+}
+
+bool hV_Frame_Store::closeFrame(uint8_t slot, uint32_t size)
+{
+    if ((_flagReady == false) or (slot >= _slots) or (size > _frameSize))
+    {
+        return false;
+    }
+
+    uint8_t header[STORE_HEADER_LENGTH];
+    for (uint8_t index = 0; index < 4; index++)
+    {
+        header[index] = (STORE_MAGIC >> (8 * index)) & 0xff;
+        header[4 + index] = (size >> (8 * index)) & 0xff;
+    }
+
+    return _program(_address(slot), header, STORE_HEADER_LENGTH);
+}
+
+bool hV_Frame_Store::storeFrame(uint8_t slot, const uint8_t * data, uint32_t size)
+{
+    return eraseFrame(slot) and writeFrame(slot, 0, data, size) and closeFrame(slot, size);
+}
+
+uint32_t hV_Frame_Store::getSize(uint8_t slot)
+{
+    if ((_flagReady == false) or (slot >= _slots))
+    {
+        return 0;
+    }
+
+    uint8_t header[STORE_HEADER_LENGTH];
+    if (_read(_address(slot), header, STORE_HEADER_LENGTH) == false)
+    {
+        return 0;
+    }
+
+    uint32_t magic = 0;
+    uint32_t size = 0;
+    for (uint8_t index = 0; index < 4; index++)
+    {
+        magic |= (uint32_t)header[index] << (8 * index);
+        size |= (uint32_t)header[4 + index] << (8 * index);
+    }
+
+    return ((magic == STORE_MAGIC) and (size <= _frameSize)) ? size : 0;
+}
+
+uint32_t hV_Frame_Store::readFrame(uint8_t slot, uint32_t offset, uint8_t * buffer, uint32_t size)
+{
+    if ((_flagReady == false) or (slot >= _slots) or (offset >= _frameSize))
+    {
+        return 0;
+    }
+
+    uint32_t length = hV_HAL_min(size, _frameSize - offset);
+    if (_read(_address(slot) + STORE_HEADER_LENGTH + offset, buffer, length) == false)
+    {
+        return 0; // Shared bus refused
+    }
+    return length;
+}
@@ -0,0 +1,179 @@
+///
+/// @file hV_Frame_Store.h
+/// @brief Frame store on external SPI flash
+///
+/// @details Project Pervasive Displays Library Suite
+/// @n Based on highView technology
+/// @n Keeps indexed, pre-rendered frames in the SPI flash wired to flashCS
+/// * One slot per frame, with header for size and validity
+/// * Chunked read into a bounce buffer, see hV_Board::b_sendIndexStore()
+///
+/// @date 17 Oct 2026
+/// @version 1000
+///
+/// @copyright (c) Pervasive Displays Inc., 2021-2025
+/// @copyright (c) Etigues, 2010-2025
+/// @copyright All rights reserved
+/// @copyright For exclusive use with Pervasive Displays screens
+///
+/// * Basic edition: for hobbyists and for basic usage
+/// @n Creative Commons Attribution-ShareAlike 4.0 International (CC BY-SA 4.0)
+/// @see https://creativecommons.org/licenses/by-sa/4.0/
+///
+/// @n Consider the Evaluation or Commercial editions for professionals or organisations and for commercial usage
+///
+/// * Evaluation edition: for professionals or organisations, evaluation only, no commercial usage
+/// @n All rights reserved
+///
+/// * Commercial edition: for professionals or organisations, commercial usage
+/// @n All rights reserved
+///
+/// * Viewer edition: for professionals or organisations
+/// @n All rights reserved
+///
+/// * Documentation
+/// @n All rights reserved
+///
+
+/// @note Example
+/// @code {.cpp}
+/// hV_Frame_Store store;
+/// store.begin(board.flashCS, frameSize_EPD_417, 0, 8000000, 4); // 4 slots
+/// store.storeFrame(0, frame, frameSize_EPD_417); // Once
+///
+/// b_sendIndexStore(0x10, store, 0, buffer, sizeof(buffer)); // Near-instant switch
+/// @endcode
+///
+
+// SDK
+#include "hV_HAL_Peripherals.h"
+
+#if (hV_HAL_PERIPHERALS_RELEASE < 1002)
+#error Required hV_HAL_PERIPHERALS_RELEASE 1002
+#endif // hV_HAL_PERIPHERALS_RELEASE
+
+#ifndef hV_FRAME_STORE_RELEASE
+///
+/// @brief Library release number
+///
+#define hV_FRAME_STORE_RELEASE 1000
+
+///
+/// @name SPI flash geometry
+/// @{
+#define FLASH_PAGE_LENGTH 256 ///< Page program, bytes
+#define FLASH_SECTOR_LENGTH 4096 ///< Sector erase, bytes
+/// @}
+
+///
+/// @brief Size of the slot header, bytes
+/// @note Magic number and frame size
+///
+#define STORE_HEADER_LENGTH 8
+
+///
+/// @brief Class for frame store
+/// @details Standard SPI NOR flash commands
+/// * 0x03 read, 0x02 page program, 0x20 sector erase
+/// * 0x06 write enable, 0x05 read status, 0x9f JEDEC identifier, 0xab release from deep power-down
+/// @note Flash accessed as SPI_DEVICE_FLASH on the shared SPI bus
+///
+class hV_Frame_Store
+{
+  public:
+
+    ///
+    /// @brief Constructor
+    ///
+    hV_Frame_Store();
+
+    ///
+    /// @brief Initialisation
+    /// @param pinCS /CS of the flash, usually flashCS of the board
+    /// @param frameSize maximum number of bytes per frame
+    /// @param base address of the first slot, default = 0
+    /// @param speed SPI speed in Hz, default = 8000000
+    /// @param slots number of slots, default = 1
+    /// @return true if a flash answers and holds all the slots, false otherwise
+    /// @note Slot size = header + frameSize, rounded up to FLASH_SECTOR_LENGTH
+    /// @note Capacity from the JEDEC identifier, limited to 16 MB by 3-byte addresses
+    /// @note SPI bus started with hV_HAL_SPI_begin() before
+    ///
+    bool begin(uint8_t pinCS, uint32_t frameSize, uint32_t base = 0, uint32_t speed = 8000000, uint8_t slots = 1);
+
+    ///
+    /// @brief Get the JEDEC identifier
+    /// @return manufacturer, type and capacity, 0 if none
+    ///
+    uint32_t getIdentifier();
+
+    ///
+    /// @brief Store a frame
+    /// @param slot slot number, less than slots
+    /// @param data frame
+    /// @param size number of bytes
+    /// @return true if stored
+    /// @note Same as eraseFrame(), writeFrame() and closeFrame()
+    ///
+    bool storeFrame(uint8_t slot, const uint8_t * data, uint32_t size);
+
+    ///
+    /// @brief Erase a slot
+    /// @param slot slot number, less than slots
+    /// @return true if erased
+    /// @note Slot empty until closeFrame()
+    ///
+    bool eraseFrame(uint8_t slot);
+
+    ///
+    /// @brief Write part of a frame into an erased slot
+    /// @param slot slot number, less than slots
+    /// @param offset position in the frame, bytes
+    /// @param data chunk
+    /// @param size number of bytes
+    /// @return true if written
+    /// @note For frames rendered by chunks with bounded RAM
+    ///
+    bool writeFrame(uint8_t slot, uint32_t offset, const uint8_t * data, uint32_t size);
+
+    ///
+    /// @brief Validate a slot
+    /// @param slot slot number, less than slots
+    /// @param size number of bytes of the frame
+    /// @return true if validated
+    ///
+    bool closeFrame(uint8_t slot, uint32_t size);
+
+    ///
+    /// @brief Get the size of a stored frame
+    /// @param slot slot number, less than slots
+    /// @return number of bytes, 0 = empty slot
+    ///
+    uint32_t getSize(uint8_t slot);
+
+    ///
+    /// @brief Read part of a stored frame
+    /// @param slot slot number, less than slots
+    /// @param offset position in the frame, bytes
+    /// @param[out] buffer bounce buffer
+    /// @param size maximum number of bytes
+    /// @return number of bytes read, 0 = end of frame, empty slot or shared bus refused
+    ///
+    uint32_t readFrame(uint8_t slot, uint32_t offset, uint8_t * buffer, uint32_t size);
+
+  private:
+
+    uint32_t _address(uint8_t slot);
+    bool _command(uint8_t command, uint32_t address, bool flagAddress);
+    bool _read(uint32_t address, uint8_t * data, uint32_t size);
+    bool _program(uint32_t address, const uint8_t * data, uint32_t size);
+    bool _waitReady();
+
+    bool _flagReady = false; ///< true = flash answered
+    uint32_t _base = 0; ///< address of the first slot
+    uint32_t _slotSize = 0; ///< bytes per slot
+    uint32_t _frameSize = 0; ///< maximum bytes per frame
+    uint8_t _slots = 0; ///< number of slots
+};
+
+#endif // hV_FRAME_STORE_RELEASE
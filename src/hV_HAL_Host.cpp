@@ -0,0 +1,416 @@
+//
+// hV_HAL_Host.cpp
+// Library C++ code
+// ----------------------------------
+//
+// Details Host back-end for the light hardware abstraction layer
+// Project highView Library Suite
+//
+// Created by Rei Vilo, 17 Oct 2026
+//
+// Copyright (c) Etigues, 2010-2025
+// Licence All rights reserved
+// For exclusive use with Pervasive Displays screens
+//
+// * Basic edition: for hobbyists and for basic usage
+// Creative Commons Attribution-ShareAlike 4.0 International (CC BY-SA 4.0)
+//
+// * Evaluation edition: for professionals or organisations, evaluation only, no commercial usage
+// All rights reserved
+//
+// * Commercial edition: for professionals or organisations, commercial usage
+// All rights reserved
+//
+// Release 1000: Initial release
+//
+
+// Library header
+#include "hV_HAL_Peripherals.h"
+
+#if defined(hV_HAL_HOST)
+
+#include <stdio.h>
+
+//
+// === Recorder section
+//
+///
+/// @brief State of the host back-end
+///
+struct h_host_t
+{
+    uint64_t clock; ///< simulated clock, ns
+    bool flagRecording; ///< true = records kept
+    hV_HostDevice * device; ///< fake device model
+    std::vector<hostRecord_t> records; ///< records
+    hostCounter_t counters; ///< counters
+};
+
+hV_HostDevice h_hostDeviceDefault;
+
+h_host_t h_host = { 0, true, &h_hostDeviceDefault, {}, {} };
+
+///
+/// @brief Add a record
+/// @param type HOST_GPIO_DEFINE to HOST_WIRE_READ
+/// @param pin pin or I2C address
+/// @param value level, mode, byte or duration
+///
+static void h_record(uint8_t type, uint8_t pin, uint32_t value)
+{
+    if (h_host.flagRecording)
+    {
+        h_host.records.push_back({ h_host.clock / 1000, type, pin, value });
+    }
+}
+
+void hV_HAL_Host_setDevice(hV_HostDevice * device)
+{
+    h_host.device = (device != 0) ? device : &h_hostDeviceDefault;
+}
+
+void hV_HAL_Host_setRecording(bool flag)
+{
+    h_host.flagRecording = flag;
+}
+
+const std::vector<hostRecord_t> & hV_HAL_Host_getRecords()
+{
+    return h_host.records;
+}
+
+hostCounter_t hV_HAL_Host_getCounters()
+{
+    return h_host.counters;
+}
+
+void hV_HAL_Host_clear()
+{
+    h_host.records.clear();
+    h_host.counters = {};
+}
+
+uint64_t hV_HAL_Host_getMicroseconds()
+{
+    return h_host.clock / 1000;
+}
+//
+// === End of Recorder section
+//
+
+//
+// === Fake device section
+//
+uint8_t hV_HostDevice::gpioRead(uint8_t pin)
+{
+    return _level[pin];
+}
+
+void hV_HostDevice::gpioWrite(uint8_t pin, uint8_t level)
+{
+    _level[pin] = level;
+}
+
+uint8_t hV_HostDevice::spiTransfer(uint8_t data)
+{
+    (void)data;
+    return 0x00;
+}
+
+uint8_t hV_HostDevice::wireWrite(uint8_t address, const uint8_t * data, size_t size)
+{
+    (void)address;
+    (void)data;
+    (void)size;
+    return 0;
+}
+
+size_t hV_HostDevice::wireRead(uint8_t address, uint8_t * data, size_t size)
+{
+    (void)address;
+    memset(data, 0x00, size);
+    return size;
+}
+//
+// === End of Fake device section
+//
+
+//
+// === Arduino SDK section
+//
+void pinMode(uint8_t pin, uint8_t mode)
+{
+    h_record(HOST_GPIO_DEFINE, pin, mode);
+}
+
+void digitalWrite(uint8_t pin, uint8_t level)
+{
+    h_host.counters.gpioWrite += 1;
+    h_record(HOST_GPIO_WRITE, pin, level);
+    h_host.device->gpioWrite(pin, level);
+}
+
+int digitalRead(uint8_t pin)
+{
+    uint8_t level = h_host.device->gpioRead(pin);
+    h_host.counters.gpioRead += 1;
+    h_record(HOST_GPIO_READ, pin, level);
+    return level;
+}
+
+void delay(unsigned long ms)
+{
+    delayMicroseconds(ms * 1000);
+}
+
+void delayMicroseconds(unsigned int us)
+{
+    h_host.counters.delay += us;
+    h_record(HOST_DELAY, 0, us);
+    h_host.clock += (uint64_t)us * 1000;
+}
+
+unsigned long millis()
+{
+    return h_host.clock / 1000000;
+}
+
+unsigned long micros()
+{
+    return h_host.clock / 1000;
+}
+
+void yield()
+{
+    // Simulated clock advanced by 1 us
+    h_host.clock += 1000;
+}
+
+String::String(const char * text)
+{
+    _text = (text != 0) ? text : "";
+}
+
+const char * String::c_str() const
+{
+    return _text.c_str();
+}
+
+unsigned int String::length() const
+{
+    return _text.length();
+}
+
+void String::toCharArray(char * buffer, unsigned int size) const
+{
+    if (size > 0)
+    {
+        strncpy(buffer, _text.c_str(), size - 1);
+        buffer[size - 1] = 0x00;
+    }
+}
+
+HostSerial Serial;
+
+void HostSerial::begin(unsigned long speed)
+{
+    (void)speed;
+}
+
+void HostSerial::print(const char * text)
+{
+    fputs(text, stdout);
+}
+
+void HostSerial::println(const char * text)
+{
+    fputs(text, stdout);
+    fputs("\n", stdout);
+}
+//
+// === End of Arduino SDK section
+//
+
+//
+// === SPI section
+//
+SPIClass SPI;
+
+SPISettings::SPISettings(uint32_t clock, uint8_t bitOrder, uint8_t dataMode)
+{
+    this->clock = clock;
+    this->bitOrder = bitOrder;
+    this->dataMode = dataMode;
+}
+
+void SPIClass::begin()
+{
+    ;
+}
+
+void SPIClass::end()
+{
+    ;
+}
+
+void SPIClass::beginTransaction(SPISettings settings)
+{
+    _clock = (settings.clock > 0) ? settings.clock : 4000000;
+    h_host.counters.spiSettings += 1;
+    h_record(HOST_SPI_SETTINGS, 0, _clock / 1000);
+}
+
+void SPIClass::endTransaction()
+{
+    ;
+}
+
+uint8_t SPIClass::transfer(uint8_t data)
+{
+    h_host.counters.spiCall += 1;
+    h_host.counters.spiByte += 1;
+    h_record(HOST_SPI_BYTE, 0, data);
+
+    // 8 clock periods per byte
+    uint64_t duration = 8000000000ULL / _clock;
+    h_host.clock += duration;
+    h_host.counters.spiTime += duration;
+
+    return h_host.device->spiTransfer(data);
+}
+
+void SPIClass::transfer(void * buffer, size_t count)
+{
+    uint8_t * data = (uint8_t *)buffer;
+    h_host.counters.spiCall += 1;
+
+    for (size_t index = 0; index < count; index++)
+    {
+        h_host.counters.spiByte += 1;
+        h_record(HOST_SPI_BYTE, 0, data[index]);
+        data[index] = h_host.device->spiTransfer(data[index]);
+    }
+
+    uint64_t duration = 8000000000ULL * count / _clock;
+    h_host.clock += duration;
+    h_host.counters.spiTime += duration;
+}
+
+void SPIClass::transfer(const void * txBuffer, void * rxBuffer, size_t count)
+{
+    const uint8_t * dataWrite = (const uint8_t *)txBuffer;
+    uint8_t * dataRead = (uint8_t *)rxBuffer;
+    h_host.counters.spiCall += 1;
+
+    for (size_t index = 0; index < count; index++)
+    {
+        h_host.counters.spiByte += 1;
+        h_record(HOST_SPI_BYTE, 0, dataWrite[index]);
+        uint8_t value = h_host.device->spiTransfer(dataWrite[index]);
+        if (dataRead != 0)
+        {
+            dataRead[index] = value;
+        }
+    }
+
+    uint64_t duration = 8000000000ULL * count / _clock;
+    h_host.clock += duration;
+    h_host.counters.spiTime += duration;
+}
+
+bool SPIClass::transferAsync(const void * txBuffer, void * rxBuffer, size_t count)
+{
+    // Bytes exchanged at start, completion at end of simulated transfer time
+    uint64_t start = h_host.clock;
+    transfer(txBuffer, rxBuffer, count);
+    _endAsync = h_host.clock;
+    h_host.clock = start;
+    return true;
+}
+
+bool SPIClass::finishedAsync()
+{
+    return (h_host.clock >= _endAsync);
+}
+//
+// === End of SPI section
+//
+
+//
+// === Wire section
+//
+TwoWire Wire;
+
+void TwoWire::begin()
+{
+    ;
+}
+
+void TwoWire::end()
+{
+    ;
+}
+
+void TwoWire::setClock(uint32_t clock)
+{
+    (void)clock;
+}
+
+void TwoWire::beginTransmission(uint8_t address)
+{
+    _address = address;
+    _bufferWrite.clear();
+}
+
+uint8_t TwoWire::endTransmission(bool stop)
+{
+    (void)stop;
+    for (uint8_t data : _bufferWrite)
+    {
+        h_record(HOST_WIRE_WRITE, _address, data);
+    }
+    h_host.counters.wireByte += _bufferWrite.size();
+
+    return h_host.device->wireWrite(_address, _bufferWrite.data(), _bufferWrite.size());
+}
+
+size_t TwoWire::write(uint8_t data)
+{
+    _bufferWrite.push_back(data);
+    return 1;
+}
+
+uint8_t TwoWire::requestFrom(uint8_t address, size_t size)
+{
+    _bufferRead.assign(size, 0x00);
+    _indexRead = 0;
+    size_t count = h_host.device->wireRead(address, _bufferRead.data(), size);
+    _bufferRead.resize(count);
+
+    for (uint8_t data : _bufferRead)
+    {
+        h_record(HOST_WIRE_READ, address, data);
+    }
+    h_host.counters.wireByte += count;
+
+    return count;
+}
+
+int TwoWire::available()
+{
+    return _bufferRead.size() - _indexRead;
+}
+
+int TwoWire::read()
+{
+    if (_indexRead < _bufferRead.size())
+    {
+        return _bufferRead[_indexRead++];
+    }
+    return -1;
+}
+//
+// === End of Wire section
+//
+
+#endif // hV_HAL_HOST
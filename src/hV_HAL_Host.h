@@ -0,0 +1,327 @@
+///
+/// @file hV_HAL_Host.h
+/// @brief Host back-end for the light hardware abstraction layer
+///
+/// @details Based on highView technology
+/// @n Stand-in for the Arduino SDK, SPI and Wire libraries on Linux
+/// * Fake GPIO, SPI and Wire device model, with recorder
+/// * Simulated clock, advanced by delays and bus transfers
+///
+/// @date 17 Oct 2026
+/// @version 1000
+///
+/// @copyright (c) Pervasive Displays Inc., 2021-2025
+/// @copyright (c) Etigues, 2010-2025
+/// @copyright All rights reserved
+/// @copyright For exclusive use with Pervasive Displays screens
+///
+/// * Basic edition: for hobbyists and for basic usage
+/// @n Creative Commons Attribution-ShareAlike 4.0 International (CC BY-SA 4.0)
+/// @see https://creativecommons.org/licenses/by-sa/4.0/
+///
+/// @n Consider the Evaluation or Commercial editions for professionals or organisations and for commercial usage
+///
+/// * Evaluation edition: for professionals or organisations, evaluation only, no commercial usage
+/// @n All rights reserved
+///
+/// * Commercial edition: for professionals or organisations, commercial usage
+/// @n All rights reserved
+///
+/// * Viewer edition: for professionals or organisations
+/// @n All rights reserved
+///
+/// * Documentation
+/// @n All rights reserved
+///
+/// @note Selected automatically by hV_HAL_Peripherals.h on Linux without Arduino SDK
+/// @note Library target PDLS_Common_Host and tests in CMakeLists.txt
+/// @code {.sh}
+/// cmake -S . -B build && cmake --build build && ctest --test-dir build
+/// @endcode
+///
+
+#ifndef hV_HAL_HOST_RELEASE
+///
+/// @brief Release
+///
+#define hV_HAL_HOST_RELEASE 1000
+
+///
+/// @brief Other libraries
+///
+#include <stdint.h>
+#include <stddef.h>
+#include <stdlib.h>
+#include <string.h>
+#include <string>
+#include <vector>
+
+///
+/// @name Arduino SDK constants
+/// @{
+#define HIGH 0x1
+#define LOW 0x0
+
+#define INPUT 0x0
+#define OUTPUT 0x1
+#define INPUT_PULLUP 0x2
+
+#define CHANGE 0x1
+#define FALLING 0x2
+#define RISING 0x3
+
+#define LSBFIRST 0x0
+#define MSBFIRST 0x1
+
+#define SPI_MODE0 0x00
+#define SPI_MODE1 0x01
+#define SPI_MODE2 0x02
+#define SPI_MODE3 0x03
+
+#define SCK 18 ///< Fake clock pin
+#define MISO 16 ///< Fake data input pin
+#define MOSI 19 ///< Fake data output pin
+/// @}
+
+///
+/// @name Arduino SDK functions
+/// @note Time is simulated, see hV_HAL_Host_getMicroseconds()
+/// @{
+void pinMode(uint8_t pin, uint8_t mode);
+void digitalWrite(uint8_t pin, uint8_t level);
+int digitalRead(uint8_t pin);
+void delay(unsigned long ms);
+void delayMicroseconds(unsigned int us);
+unsigned long millis();
+unsigned long micros();
+void yield();
+/// @}
+
+///
+/// @brief Minimal String class
+/// @note Only the functions used by the library
+///
+class String
+{
+  public:
+    String(const char * text = "");
+    const char * c_str() const;
+    unsigned int length() const;
+    void toCharArray(char * buffer, unsigned int size) const;
+
+  private:
+    std::string _text;
+};
+
+///
+/// @brief Console on standard output
+///
+class HostSerial
+{
+  public:
+    void begin(unsigned long speed);
+    void print(const char * text);
+    void println(const char * text = "");
+};
+
+extern HostSerial Serial;
+
+///
+/// @brief SPI settings
+///
+class SPISettings
+{
+  public:
+    SPISettings(uint32_t clock = 4000000, uint8_t bitOrder = MSBFIRST, uint8_t dataMode = SPI_MODE0);
+
+    uint32_t clock; ///< in Hz
+    uint8_t bitOrder; ///< LSBFIRST, MSBFIRST
+    uint8_t dataMode; ///< SPI_MODE0, SPI_MODE1, SPI_MODE2, SPI_MODE3
+};
+
+///
+/// @brief SPI stand-in
+/// @note Each byte advances the simulated clock by 8 periods
+/// @note Asynchronous transfer completes when the simulated clock reaches its end
+///
+class SPIClass
+{
+  public:
+    void begin();
+    void end();
+    void beginTransaction(SPISettings settings);
+    void endTransaction();
+    uint8_t transfer(uint8_t data);
+    void transfer(void * buffer, size_t count);
+    void transfer(const void * txBuffer, void * rxBuffer, size_t count);
+    bool transferAsync(const void * txBuffer, void * rxBuffer, size_t count);
+    bool finishedAsync();
+
+  private:
+    uint32_t _clock = 4000000;
+    uint64_t _endAsync = 0;
+};
+
+extern SPIClass SPI;
+
+///
+/// @brief Wire stand-in
+///
+class TwoWire
+{
+  public:
+    void begin();
+    void end();
+    void setClock(uint32_t clock);
+    void beginTransmission(uint8_t address);
+    uint8_t endTransmission(bool stop = true);
+    size_t write(uint8_t data);
+    uint8_t requestFrom(uint8_t address, size_t size);
+    int available();
+    int read();
+
+  private:
+    uint8_t _address = 0;
+    std::vector<uint8_t> _bufferWrite;
+    std::vector<uint8_t> _bufferRead;
+    size_t _indexRead = 0;
+};
+
+extern TwoWire Wire;
+
+///
+/// @name Recorder
+/// @{
+
+///
+/// @name Types of records
+/// @note Numbers are sequential and exclusive
+/// @{
+#define HOST_GPIO_DEFINE 0x01 ///< pinMode(), pin, mode
+#define HOST_GPIO_WRITE 0x02 ///< digitalWrite(), pin, level
+#define HOST_GPIO_READ 0x03 ///< digitalRead(), pin, level
+#define HOST_DELAY 0x04 ///< delay() or delayMicroseconds(), value = us
+#define HOST_SPI_SETTINGS 0x05 ///< beginTransaction(), value = clock in kHz
+#define HOST_SPI_BYTE 0x06 ///< byte written, value = byte
+#define HOST_WIRE_WRITE 0x07 ///< byte written, pin = address, value = byte
+#define HOST_WIRE_READ 0x08 ///< byte read, pin = address, value = byte
+/// @}
+
+///
+/// @brief Record of a bus access
+///
+struct hostRecord_t
+{
+    uint64_t time; ///< simulated time, us
+    uint8_t type; ///< HOST_GPIO_DEFINE to HOST_WIRE_READ
+    uint8_t pin; ///< pin, or I2C address
+    uint32_t value; ///< level, mode, byte or duration
+};
+
+///
+/// @brief Counters of bus accesses
+///
+struct hostCounter_t
+{
+    uint32_t gpioWrite; ///< number of digitalWrite()
+    uint32_t gpioRead; ///< number of digitalRead()
+    uint32_t spiByte; ///< number of bytes on SPI
+    uint32_t spiCall; ///< number of calls to SPI.transfer()
+    uint32_t spiSettings; ///< number of SPI settings changes
+    uint32_t wireByte; ///< number of bytes on Wire
+    uint64_t delay; ///< total of delays, us
+    uint64_t spiTime; ///< total of SPI transfer time, ns
+};
+
+///
+/// @brief Fake device model
+/// @details Default implementation answers low levels and 0x00 bytes
+/// @note Derive to model a device, then select it with hV_HAL_Host_setDevice()
+///
+class hV_HostDevice
+{
+  public:
+    virtual ~hV_HostDevice() = default;
+
+    ///
+    /// @brief Level read on a GPIO
+    /// @param pin pin
+    /// @return HIGH or LOW, default = last level written
+    ///
+    virtual uint8_t gpioRead(uint8_t pin);
+
+    ///
+    /// @brief Level written on a GPIO
+    /// @param pin pin
+    /// @param level HIGH or LOW
+    ///
+    virtual void gpioWrite(uint8_t pin, uint8_t level);
+
+    ///
+    /// @brief Byte exchanged on SPI
+    /// @param data byte written
+    /// @return byte read, default = 0x00
+    ///
+    virtual uint8_t spiTransfer(uint8_t data);
+
+    ///
+    /// @brief Bytes written on Wire
+    /// @param address I2C address
+    /// @param data buffer
+    /// @param size number of bytes
+    /// @return status, default = 0 = success
+    ///
+    virtual uint8_t wireWrite(uint8_t address, const uint8_t * data, size_t size);
+
+    ///
+    /// @brief Bytes read on Wire
+    /// @param address I2C address
+    /// @param[out] data buffer
+    /// @param size number of bytes
+    /// @return number of bytes read, default = size with 0x00
+    ///
+    virtual size_t wireRead(uint8_t address, uint8_t * data, size_t size);
+
+  protected:
+    uint8_t _level[256] = {0}; ///< last level written per pin
+};
+
+///
+/// @brief Select the fake device model
+/// @param device device, 0 = default device
+///
+void hV_HAL_Host_setDevice(hV_HostDevice * device);
+
+///
+/// @brief Enable or disable the recorder
+/// @param flag true = record each access, false = counters only
+///
+void hV_HAL_Host_setRecording(bool flag);
+
+///
+/// @brief Get the records
+/// @return vector of records
+///
+const std::vector<hostRecord_t> & hV_HAL_Host_getRecords();
+
+///
+/// @brief Get the counters
+/// @return counters
+///
+hostCounter_t hV_HAL_Host_getCounters();
+
+///
+/// @brief Clear records and counters
+/// @note Simulated clock not reset
+///
+void hV_HAL_Host_clear();
+
+///
+/// @brief Get the simulated clock
+/// @return time in us
+///
+uint64_t hV_HAL_Host_getMicroseconds();
+
+/// @}
+
+#endif // hV_HAL_HOST_RELEASE
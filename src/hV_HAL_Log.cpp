@@ -0,0 +1,610 @@
+//
+// hV_HAL_Log.cpp
+// Library C++ code
+// ----------------------------------
+//
+// Details Deferred binary logger for the light hardware abstraction layer
+// Project highView Library Suite
+//
+// Created by Rei Vilo, 17 Oct 2026
+//
+// Copyright (c) Etigues, 2010-2025
+// Licence All rights reserved
+// For exclusive use with Pervasive Displays screens
+//
+// * Basic edition: for hobbyists and for basic usage
+// Creative Commons Attribution-ShareAlike 4.0 International (CC BY-SA 4.0)
+//
+// * Evaluation edition: for professionals or organisations, evaluation only, no commercial usage
+// All rights reserved
+//
+// * Commercial edition: for professionals or organisations, commercial usage
+// All rights reserved
+//
+// Release 1000: Initial release
+// Release 1001: Immediate output when the table of formats is full
+//
+
+// Library header
+#include "hV_HAL_Peripherals.h"
+
+#include <string.h>
+
+//
+// === Format section
+//
+///
+/// @brief Tables of formats
+///
+struct h_logFormat_t
+{
+    const char * const * formats; ///< table set by hV_HAL_Log_setFormats()
+    uint16_t number; ///< number of formats in the table
+    const char * dynamic[LOG_FORMAT_NUMBER]; ///< formats registered by hV_HAL_log()
+    uint8_t count; ///< number of formats registered
+};
+
+h_logFormat_t h_logFormat = { 0, 0, {}, 0 };
+
+void hV_HAL_Log_setFormats(const char * const * formats, uint16_t number)
+{
+    h_logFormat.formats = formats;
+    h_logFormat.number = number;
+}
+
+///
+/// @brief Get the format string of an identifier
+/// @param format format identifier
+/// @return format string, 0 if unknown
+///
+static const char * h_Log_getFormat(uint16_t format)
+{
+    if (format >= LOG_FORMAT_DYNAMIC)
+    {
+        uint16_t index = format - LOG_FORMAT_DYNAMIC;
+        return (index < h_logFormat.count) ? h_logFormat.dynamic[index] : 0;
+    }
+
+    return (format < h_logFormat.number) ? h_logFormat.formats[format] : 0;
+}
+
+#if defined(hV_HAL_LOG_DEFERRED)
+
+///
+/// @brief Get the identifier of a format string
+/// @param format format string
+/// @param[out] identifier format identifier
+/// @return true if found or registered, false if the table is full
+/// @note Pointers compared, format strings expected to be literals
+///
+static bool h_Log_getIdentifier(const char * format, uint16_t & identifier)
+{
+    for (uint16_t index = 0; index < h_logFormat.number; index++)
+    {
+        if (h_logFormat.formats[index] == format)
+        {
+            identifier = index;
+            return true;
+        }
+    }
+
+    for (uint8_t index = 0; index < h_logFormat.count; index++)
+    {
+        if (h_logFormat.dynamic[index] == format)
+        {
+            identifier = LOG_FORMAT_DYNAMIC + index;
+            return true;
+        }
+    }
+
+    if (h_logFormat.count < LOG_FORMAT_NUMBER)
+    {
+        h_logFormat.dynamic[h_logFormat.count] = format;
+        identifier = LOG_FORMAT_DYNAMIC + h_logFormat.count;
+        h_logFormat.count += 1;
+        return true;
+    }
+
+    return false;
+}
+
+#endif // hV_HAL_LOG_DEFERRED
+
+///
+/// @brief Parse a conversion specification
+/// @param[in] format pointer after %
+/// @param[out] specification specification without length modifier, null terminated
+/// @param[out] modifier number of l modifiers
+/// @return pointer after the conversion
+///
+static const char * h_Log_parse(const char * format, char * specification, uint8_t & modifier)
+{
+    uint8_t length = 0;
+    modifier = 0;
+
+    specification[length++] = '%';
+    while ((*format != 0x00) and (strchr("-+ #0123456789.hlLzjt", *format) != 0))
+    {
+        if (*format == 'l')
+        {
+            modifier += 1;
+        }
+        else if ((strchr("hLzjt", *format) == 0) and (length < 12))
+        {
+            specification[length++] = *format;
+        }
+        format++;
+    }
+
+    if (*format != 0x00)
+    {
+        specification[length++] = *format;
+        format++;
+    }
+    specification[length] = 0x00;
+    return format;
+}
+
+uint16_t hV_HAL_Log_format(char * buffer, uint16_t size, const logRecord_t & record)
+{
+    if (size == 0)
+    {
+        return 0;
+    }
+
+    const char * format = h_Log_getFormat(record.format);
+    if (format == 0)
+    {
+        int written = snprintf(buffer, size, "Format %u", record.format);
+        return hV_HAL_min((uint16_t)written, (uint16_t)(size - 1));
+    }
+
+    uint16_t length = 0;
+    uint8_t index = 0;
+    char specification[16];
+    uint8_t modifier;
+
+    while ((*format != 0x00) and (length + 1 < size))
+    {
+        if (*format != '%')
+        {
+            buffer[length++] = *format++;
+            continue;
+        }
+
+        format++;
+        if (*format == '%')
+        {
+            buffer[length++] = '%';
+            format++;
+            continue;
+        }
+
+        format = h_Log_parse(format, specification, modifier);
+        uint8_t last = strlen(specification) - 1;
+        char conversion = specification[last];
+        uint32_t value = (index < record.number) ? record.argument[index] : 0;
+        index += 1;
+
+        int written = 0;
+        switch (conversion)
+        {
+            case 'd':
+            case 'i':
+            case 'o':
+            case 'u':
+            case 'x':
+            case 'X':
+
+                // Arguments stored as 32 bits, printed as long for 16-bit int platforms
+                specification[last] = 'l';
+                specification[last + 1] = conversion;
+                specification[last + 2] = 0x00;
+                if ((conversion == 'd') or (conversion == 'i'))
+                {
+                    written = snprintf(&buffer[length], size - length, specification, (long)(int32_t)value);
+                }
+                else
+                {
+                    written = snprintf(&buffer[length], size - length, specification, (unsigned long)value);
+                }
+                break;
+
+            case 'c':
+
+                written = snprintf(&buffer[length], size - length, specification, (int)value);
+                break;
+
+            case 'e':
+            case 'E':
+            case 'f':
+            case 'F':
+            case 'g':
+            case 'G':
+            {
+                float number;
+                memcpy(&number, &value, sizeof(number));
+                written = snprintf(&buffer[length], size - length, specification, (double)number);
+                break;
+            }
+
+            default:
+
+                // Strings and pointers not deferred
+                written = snprintf(&buffer[length], size - length, "?");
+                break;
+        }
+
+        if (written > 0)
+        {
+            length = hV_HAL_min((uint16_t)(length + written), (uint16_t)(size - 1));
+        }
+    }
+
+    buffer[length] = 0x00;
+    return length;
+}
+
+///
+/// @brief Send a record to console
+/// @param record record
+/// @note Same output as hV_HAL_log()
+///
+static void h_Log_send(const logRecord_t & record)
+{
+    char buffer[LOG_TEXT_LENGTH];
+    hV_HAL_Log_format(buffer, sizeof(buffer), record);
+
+    hV_HAL_Serial.print("hV _ ");
+    hV_HAL_Serial.println(buffer);
+}
+
+///
+/// @brief Format and send a message to console
+/// @param format format string
+/// @param args arguments
+///
+static void h_Log_sendList(const char * format, va_list args)
+{
+    char buffer[LOG_TEXT_LENGTH] = {0x00};
+    vsnprintf(buffer, sizeof(buffer), format, args);
+
+    hV_HAL_Serial.print("hV _ ");
+    hV_HAL_Serial.println(buffer);
+}
+
+#if defined(hV_HAL_LOG_DEFERRED)
+
+///
+/// @brief Collect the arguments of a format string
+/// @param[out] record record with arguments and number
+/// @param[in] format format string
+/// @param[in] args arguments
+///
+static void h_Log_collect(logRecord_t & record, const char * format, va_list args)
+{
+    char specification[16];
+    uint8_t modifier;
+
+    record.number = 0;
+    while (*format != 0x00)
+    {
+        if (*format++ != '%')
+        {
+            continue;
+        }
+
+        if (*format == '%')
+        {
+            format++;
+            continue;
+        }
+
+        format = h_Log_parse(format, specification, modifier);
+        char conversion = specification[strlen(specification) - 1];
+        uint32_t value = 0;
+
+        switch (conversion)
+        {
+            case 'd':
+            case 'i':
+            case 'c':
+            case 'o':
+            case 'u':
+            case 'x':
+            case 'X':
+
+                if (modifier > 1)
+                {
+                    value = (uint32_t)va_arg(args, long long);
+                }
+                else if (modifier == 1)
+                {
+                    value = (uint32_t)va_arg(args, long);
+                }
+                else
+                {
+                    value = (uint32_t)va_arg(args, int);
+                }
+                break;
+
+            case 'e':
+            case 'E':
+            case 'f':
+            case 'F':
+            case 'g':
+            case 'G':
+            {
+                float number = (float)va_arg(args, double);
+                memcpy(&value, &number, sizeof(value));
+                break;
+            }
+
+            default:
+
+                // Strings and pointers not deferred
+                va_arg(args, void *);
+                break;
+        }
+
+        if (record.number < LOG_ARGUMENT_NUMBER)
+        {
+            record.argument[record.number] = value;
+            record.number += 1;
+        }
+    }
+}
+
+#endif // hV_HAL_LOG_DEFERRED
+//
+// === End of Format section
+//
+
+//
+// === Ring buffer section
+//
+#if defined(hV_HAL_LOG_DEFERRED)
+
+///
+/// @brief Ring buffer
+/// @note Lock-free for a single producer and a single consumer
+/// * Producer: hV_HAL_Log_record() and hV_HAL_log(), updates head only
+/// * Consumer: hV_HAL_Log_flush() and hV_HAL_Log_copy(), updates tail only
+/// @note Newest record dropped when full
+///
+struct h_log_t
+{
+    logRecord_t records[LOG_LENGTH]; ///< ring buffer
+    volatile uint32_t head; ///< number of records written
+    volatile uint32_t tail; ///< number of records read
+    volatile uint32_t dropped; ///< number of records dropped since last clear
+    uint32_t reported; ///< number of records dropped at last flush
+};
+
+h_log_t h_log = { {}, 0, 0, 0, 0 };
+
+///
+/// @brief Reserve a record
+/// @return record, 0 if the ring buffer is full
+///
+static logRecord_t * h_Log_reserve()
+{
+    uint32_t head = h_log.head;
+
+    if (head - h_log.tail >= LOG_LENGTH)
+    {
+        h_log.dropped += 1;
+        return 0;
+    }
+
+    return &h_log.records[head % LOG_LENGTH];
+}
+
+///
+/// @brief Publish the reserved record
+///
+static inline void h_Log_commit()
+{
+    h_log.head = h_log.head + 1;
+}
+
+void hV_HAL_Log_record(uint16_t level, uint16_t format, uint8_t number, ...)
+{
+    logRecord_t * record = h_Log_reserve();
+    if (record == 0)
+    {
+        return;
+    }
+
+    record->time = micros();
+    record->format = format;
+    record->level = level;
+    record->number = hV_HAL_min(number, (uint8_t)LOG_ARGUMENT_NUMBER);
+
+    va_list args;
+    va_start(args, number);
+    for (uint8_t index = 0; index < record->number; index++)
+    {
+        record->argument[index] = va_arg(args, uint32_t);
+    }
+    va_end(args);
+
+    h_Log_commit();
+}
+
+void hV_HAL_Log_recordList(uint16_t level, const char * format, va_list args)
+{
+    uint16_t identifier;
+    if (h_Log_getIdentifier(format, identifier) == false)
+    {
+        // Table of formats full, immediate output
+        h_Log_sendList(format, args);
+        return;
+    }
+
+    logRecord_t * record = h_Log_reserve();
+    if (record == 0)
+    {
+        return;
+    }
+
+    record->time = micros();
+    record->format = identifier;
+    record->level = level;
+    h_Log_collect(*record, format, args);
+
+    h_Log_commit();
+}
+
+uint16_t hV_HAL_Log_flush(uint16_t maximum)
+{
+    uint16_t count = 0;
+
+    uint32_t dropped = h_log.dropped;
+    if (dropped != h_log.reported)
+    {
+        hV_HAL_Serial_printf("hV _ Log dropped %lu", (unsigned long)(dropped - h_log.reported));
+        hV_HAL_Serial_crlf();
+        h_log.reported = dropped;
+    }
+
+    while ((h_log.tail != h_log.head) and ((maximum == 0) or (count < maximum)))
+    {
+        uint32_t tail = h_log.tail;
+        h_Log_send(h_log.records[tail % LOG_LENGTH]);
+        h_log.tail = tail + 1;
+        count += 1;
+    }
+
+    return count;
+}
+
+uint32_t hV_HAL_Log_copy(logRecord_t * records, uint32_t size)
+{
+    uint32_t number = 0;
+
+    while ((h_log.tail != h_log.head) and (number < size))
+    {
+        uint32_t tail = h_log.tail;
+        records[number] = h_log.records[tail % LOG_LENGTH];
+        h_log.tail = tail + 1;
+        number += 1;
+    }
+
+    return number;
+}
+
+uint32_t hV_HAL_Log_getDropped()
+{
+    return h_log.dropped;
+}
+
+void hV_HAL_Log_clear()
+{
+    h_log.tail = h_log.head;
+    h_log.dropped = 0;
+    h_log.reported = 0;
+}
+
+#else
+
+void hV_HAL_Log_record(uint16_t level, uint16_t format, uint8_t number, ...)
+{
+    logRecord_t record = {};
+
+    record.time = micros();
+    record.format = format;
+    record.level = level;
+    record.number = hV_HAL_min(number, (uint8_t)LOG_ARGUMENT_NUMBER);
+
+    va_list args;
+    va_start(args, number);
+    for (uint8_t index = 0; index < record.number; index++)
+    {
+        record.argument[index] = va_arg(args, uint32_t);
+    }
+    va_end(args);
+
+    h_Log_send(record);
+}
+
+void hV_HAL_Log_recordList(uint16_t level, const char * format, va_list args)
+{
+    (void)level;
+    h_Log_sendList(format, args);
+}
+
+uint16_t hV_HAL_Log_flush(uint16_t maximum)
+{
+    (void)maximum;
+    return 0;
+}
+
+uint32_t hV_HAL_Log_copy(logRecord_t * records, uint32_t size)
+{
+    (void)records;
+    (void)size;
+    return 0;
+}
+
+uint32_t hV_HAL_Log_getDropped()
+{
+    return 0;
+}
+
+void hV_HAL_Log_clear()
+{
+    ;
+}
+
+#endif // hV_HAL_LOG_DEFERRED
+//
+// === End of Ring buffer section
+//
+
+//
+// === Decoder section
+//
+#if defined(hV_HAL_HOST)
+
+void hV_HAL_Log_decode(FILE * file, const logRecord_t * records, uint32_t size)
+{
+    char buffer[LOG_TEXT_LENGTH];
+
+    for (uint32_t index = 0; index < size; index++)
+    {
+        const logRecord_t & record = records[index];
+        char symbol;
+
+        switch (record.level)
+        {
+            case LEVEL_CRITICAL:
+
+                symbol = '*';
+                break;
+
+            case LEVEL_DEBUG:
+
+                symbol = '-';
+                break;
+
+            case LEVEL_SYSTEM:
+
+                symbol = '=';
+                break;
+
+            default:
+
+                symbol = '.';
+                break;
+        }
+
+        hV_HAL_Log_format(buffer, sizeof(buffer), record);
+        fprintf(file, "%10u %c %s\n", record.time, symbol, buffer);
+    }
+}
+
+#endif // hV_HAL_HOST
+//
+// === End of Decoder section
+//
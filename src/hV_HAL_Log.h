@@ -0,0 +1,198 @@
+///
+/// @file hV_HAL_Log.h
+/// @brief Deferred binary logger for the light hardware abstraction layer
+///
+/// @details Based on highView technology
+/// @n Stores a format identifier, a level and raw arguments into a ring buffer
+/// * Target: deferred mode enabled by defining hV_HAL_LOG_DEFERRED, otherwise immediate output
+/// * Formatting and output from an idle hook with hV_HAL_Log_flush()
+/// * Host back-end: decoding of records copied from a target
+///
+/// @date 17 Oct 2026
+/// @version 1001
+///
+/// @copyright (c) Pervasive Displays Inc., 2021-2025
+/// @copyright (c) Etigues, 2010-2025
+/// @copyright All rights reserved
+/// @copyright For exclusive use with Pervasive Displays screens
+///
+/// * Basic edition: for hobbyists and for basic usage
+/// @n Creative Commons Attribution-ShareAlike 4.0 International (CC BY-SA 4.0)
+/// @see https://creativecommons.org/licenses/by-sa/4.0/
+///
+/// @n Consider the Evaluation or Commercial editions for professionals or organisations and for commercial usage
+///
+/// * Evaluation edition: for professionals or organisations, evaluation only, no commercial usage
+/// @n All rights reserved
+///
+/// * Commercial edition: for professionals or organisations, commercial usage
+/// @n All rights reserved
+///
+/// * Viewer edition: for professionals or organisations
+/// @n All rights reserved
+///
+/// * Documentation
+/// @n All rights reserved
+///
+/// @note Example with a table of formats
+/// @code {.cpp}
+/// const char * const formats[] = { "Update %i ms", "Temperature %i C" };
+/// hV_HAL_Log_setFormats(formats, 2);
+///
+/// hV_HAL_Log_record(LEVEL_INFO, 0, 1, duration); // fast, no formatting
+///
+/// void loop()
+/// {
+///     hV_HAL_Log_flush(); // idle hook, formatting and output
+/// }
+/// @endcode
+///
+
+#ifndef hV_HAL_LOG_RELEASE
+///
+/// @brief Release
+///
+#define hV_HAL_LOG_RELEASE 1001
+
+///
+/// @brief Other libraries
+///
+#include <stdint.h>
+#include <stdio.h>
+#include <stdarg.h>
+
+///
+/// @brief Option for deferred log
+/// @note Define hV_HAL_LOG_DEFERRED before including the library, or on the command line
+/// @note Without hV_HAL_LOG_DEFERRED, messages are formatted and sent immediately
+///
+// #define hV_HAL_LOG_DEFERRED
+
+///
+/// @brief Number of records in the ring buffer
+/// @note 28 bytes per record
+///
+#ifndef LOG_LENGTH
+#define LOG_LENGTH 32
+#endif // LOG_LENGTH
+
+///
+/// @brief Maximum number of arguments per record
+///
+#define LOG_ARGUMENT_NUMBER 4
+
+///
+/// @brief Number of formats registered by hV_HAL_log()
+/// @note Formats not in the table of hV_HAL_Log_setFormats()
+///
+#ifndef LOG_FORMAT_NUMBER
+#define LOG_FORMAT_NUMBER 16
+#endif // LOG_FORMAT_NUMBER
+
+///
+/// @brief First identifier for formats registered by hV_HAL_log()
+///
+#define LOG_FORMAT_DYNAMIC 0x8000
+
+///
+/// @brief Log record
+/// @note Fixed binary layout, suitable for transfer from target to host
+///
+struct logRecord_t
+{
+    uint32_t time; ///< time stamp, us
+    uint32_t argument[LOG_ARGUMENT_NUMBER]; ///< raw arguments, 32 bits each
+    uint16_t format; ///< format identifier
+    uint16_t level; ///< LEVEL_CRITICAL to LEVEL_SYSTEM
+    uint8_t number; ///< number of arguments
+};
+
+///
+/// @brief Set the table of formats
+/// @param formats table of format strings, index = format identifier
+/// @param number number of formats
+/// @warning Table must remain unchanged while records are pending
+/// @note Same table required on the host to decode records from a target
+///
+void hV_HAL_Log_setFormats(const char * const * formats, uint16_t number);
+
+///
+/// @brief Record a message with a format identifier
+/// @param level LEVEL_CRITICAL to LEVEL_SYSTEM
+/// @param format format identifier, index in the table of formats
+/// @param number number of arguments, up to LOG_ARGUMENT_NUMBER
+/// @param ... arguments as uint32_t, float passed as bits
+/// @note Deferred mode: lock-free, record dropped and counted if the ring buffer is full
+/// @note Otherwise: formatted and sent immediately
+///
+void hV_HAL_Log_record(uint16_t level, uint16_t format, uint8_t number, ...);
+
+///
+/// @brief Record a message with a format string
+/// @param level LEVEL_CRITICAL to LEVEL_SYSTEM
+/// @param format format string, registered at first use
+/// @param args arguments
+/// @note Called by hV_HAL_log() in deferred mode
+/// @note Formatted and sent immediately when the table of LOG_FORMAT_NUMBER formats is full,
+/// ahead of the pending records
+/// @note Conversions c d i o u x X, and e f g as float
+/// * Strings s not deferred, output as ?
+/// * Width and precision * not supported
+///
+void hV_HAL_Log_recordList(uint16_t level, const char * format, va_list args);
+
+///
+/// @brief Format a record
+/// @param[out] buffer text
+/// @param[in] size size of the buffer
+/// @param[in] record record
+/// @return number of characters, without final null
+///
+uint16_t hV_HAL_Log_format(char * buffer, uint16_t size, const logRecord_t & record);
+
+///
+/// @brief Format and send the pending records to console
+/// @param maximum maximum number of records, default = 0 = all
+/// @return number of records sent
+/// @note Call from an idle hook, for example loop()
+/// @note Number of dropped records sent if changed since last call
+/// @note Returns 0 without hV_HAL_LOG_DEFERRED
+///
+uint16_t hV_HAL_Log_flush(uint16_t maximum = 0);
+
+///
+/// @brief Copy and remove the pending records, oldest first
+/// @param[out] records buffer
+/// @param[in] size maximum number of records
+/// @return number of records copied
+/// @note For transfer to the host
+/// @note Returns 0 without hV_HAL_LOG_DEFERRED
+///
+uint32_t hV_HAL_Log_copy(logRecord_t * records, uint32_t size);
+
+///
+/// @brief Get the number of records dropped
+/// @return number of records lost since last clear
+///
+uint32_t hV_HAL_Log_getDropped();
+
+///
+/// @brief Clear the ring buffer and the counter of dropped records
+///
+void hV_HAL_Log_clear();
+
+#if defined(hV_HAL_HOST)
+
+///
+/// @brief Decode records as text
+/// @param file output file
+/// @param records records, oldest first
+/// @param size number of records
+/// @note One line per record, with time stamp and level
+/// @note Host back-end only
+///
+void hV_HAL_Log_decode(FILE * file, const logRecord_t * records, uint32_t size);
+
+#endif // hV_HAL_HOST
+
+#endif // hV_HAL_LOG_RELEASE
@@ -34,6 +34,17 @@
 // Release 911: Added overtime check on I²C write and read transfer
 // Release 922: Improved 3-wire SPI stability
 // Release 922: Ported to C
+// Release 1002: Added SPI buffer write
+// Release 1002: Added asynchronous SPI write
+// Release 1002: Added SPI fixed value write
+// Release 1002: Improved 3-wire SPI speed and added block functions
+// Release 1002: Added SPI clock profiles
+// Release 1002: Added SPI bus arbiter for shared devices
+// Release 1002: Added host back-end
+// Release 1002: Added trace recorder
+// Release 1002: Added deferred log
+// Release 1002: Added edge-triggered GPIO wait with timeout
+// Release 1002: Added SPI buffer read
 //
 
 // Library header
@@ -54,28 +65,103 @@ struct _SPISettings_s
     uint8_t bitOrder; ///< LSBFIRST, MSBFIRST
     uint8_t dataMode; ///< SPI_MODE0, SPI_MODE1, SPI_MODE2, SPI_MODE3
 };
+
+typedef _SPISettings_s h_settingSPI_t;
+#else
+typedef SPISettings h_settingSPI_t;
+#endif // ENERGIA
+
 ///
-/// @brief SPI settings for screen
+/// @brief SPI clock profiles for screen
+/// @note Settings objects cached, to avoid building them at each switch
 ///
-_SPISettings_s _settingScreen;
-#else
+struct h_profileSPI_t
+{
+    h_settingSPI_t setting[SPI_PROFILE_NUMBER]; ///< cached settings
+    uint32_t speed[SPI_PROFILE_NUMBER]; ///< in Hz
+    uint8_t active; ///< active profile
+    bool flagTransaction; ///< true = transaction started
+};
+
+h_profileSPI_t h_profileSPI;
+
 ///
-/// @brief SPI settings for screen
+/// @brief SPI device on the shared bus
 ///
-SPISettings _settingScreen;
-#endif // ENERGIA
+struct h_deviceSPI_t
+{
+    h_settingSPI_t setting; ///< cached settings, not used for SPI_DEVICE_PANEL
+    uint8_t pinCS; ///< /CS managed by the arbiter, or NOT_CONNECTED = managed by the caller
+    uint8_t depth; ///< number of nested acquisitions
+};
+
+///
+/// @brief Arbiter for the shared SPI bus
+///
+struct h_busSPI_t
+{
+    h_deviceSPI_t device[SPI_DEVICE_NUMBER]; ///< devices
+    uint8_t owner; ///< device holding the bus, SPI_DEVICE_NONE = none
+    uint8_t applied; ///< device with settings applied to the bus
+    uint8_t stack[SPI_DEVICE_NUMBER]; ///< devices preempted by the owner
+    uint8_t count; ///< number of devices preempted
+};
+
+h_busSPI_t h_busSPI =
+{
+    { { {}, 0xff, 0 }, { {}, 0xff, 0 }, { {}, 0xff, 0 } }, // device, /CS managed by the caller
+    SPI_DEVICE_NONE, // owner
+    SPI_DEVICE_PANEL, // applied
+    { SPI_DEVICE_NONE, SPI_DEVICE_NONE, SPI_DEVICE_NONE }, // stack
+    0 // count
+};
 
 #ifndef SPI_CLOCK_MAX
 #define SPI_CLOCK_MAX 16000000
 #endif
 
+///
+/// @brief Direct port access for 3-wire SPI
+/// @note Platforms with documented port registers only, otherwise digitalWrite() and digitalRead()
+///
+#if defined(__AVR__)
+#define SPI3_PORT_ACCESS
+#include <util/atomic.h>
+typedef volatile uint8_t h_portSPI3_t;
+#elif defined(ARDUINO_ARCH_SAMD)
+#define SPI3_PORT_ACCESS
+typedef volatile uint32_t h_portSPI3_t;
+#endif // SPI3_PORT_ACCESS
+
+///
+/// @brief Configuration of 3-wire SPI
+///
 struct h_pinSPI3_t
 {
-    uint8_t pinClock;
-    uint8_t pinData;
+    uint8_t pinClock; ///< clock pin
+    uint8_t pinData; ///< combined data pin
+    uint8_t modeData; ///< INPUT, OUTPUT or SPI3_MODE_NONE
+    bool flagClock; ///< true = clock pin configured
+    uint16_t halfBit; ///< wait per half-bit, us
+#if defined(SPI3_PORT_ACCESS)
+#if defined(ARDUINO_ARCH_SAMD)
+    h_portSPI3_t * clockSet; ///< clock set register, atomic
+    h_portSPI3_t * clockClear; ///< clock clear register, atomic
+    h_portSPI3_t * dataSet; ///< data set register, atomic
+    h_portSPI3_t * dataClear; ///< data clear register, atomic
+#else
+    h_portSPI3_t * clockOut; ///< clock output register
+    h_portSPI3_t * dataOut; ///< data output register
+#endif // ARDUINO_ARCH_SAMD
+    h_portSPI3_t * dataIn; ///< data input register
+    uint32_t clockMask; ///< clock bit mask
+    uint32_t dataMask; ///< data bit mask
+#endif // SPI3_PORT_ACCESS
 };
 
-h_pinSPI3_t h_pinSPI3;
+#define SPI3_MODE_NONE 0xff ///< Data pin direction not defined
+
+h_pinSPI3_t h_pinSPI3 = { SCK, MOSI, SPI3_MODE_NONE, false, 1 };
 
 void hV_HAL_begin()
 {
@@ -112,11 +198,21 @@ void hV_HAL_begin()
 void hV_HAL_exit(uint8_t code)
 {
     hV_HAL_log(LEVEL_INFO, "Exit with code %i", code);
+    hV_HAL_Log_flush(); // Pending records with deferred log
     hV_HAL_Serial_crlf();
+
+#if defined(hV_HAL_HOST)
+
+    exit(code);
+
+#else
+
     while (true)
     {
         hV_HAL_delayMilliseconds(1000);
     }
+
+#endif // hV_HAL_HOST
 }
 //
 // === End of General section
@@ -148,16 +244,219 @@ void hV_HAL_GPIO_undefine(uint8_t pin)
 
 #endif // ENERGIA_ARCH_CC13X2 or ENERGIA_ARCH_CC13XX
 
+#else
+
+    (void)pin;
+
 #endif // ENERGIA
 }
 
-void hV_HAL_GPIO_waitFor(uint8_t pin, uint8_t state)
+///
+/// @brief Interrupt for GPIO wait
+/// @note Not implemented in Energia and host back-end
+///
+#if !defined(ENERGIA) && !defined(hV_HAL_HOST)
+#define GPIO_INTERRUPT
+#endif // ENERGIA hV_HAL_HOST
+
+#if defined(__AVR__)
+#include <avr/sleep.h>
+#endif // __AVR__
+
+///
+/// @brief State of the GPIO wait
+///
+struct h_waitGPIO_t
+{
+    volatile bool flagEdge; ///< true = edge detected by interrupt
+    bool flagInterrupt; ///< true = interrupt attached, false = polling
+    uint8_t pin; ///< pin
+    uint8_t state; ///< state to reach
+    uint8_t status; ///< WAIT_NONE to WAIT_TIMEOUT
+    uint32_t start; ///< start, ms
+    uint32_t timeout; ///< maximum duration, ms, 0 = none
+    void (* callback)(uint8_t status); ///< called on completion
+};
+
+h_waitGPIO_t h_waitGPIO = { false, false, 0, 0, WAIT_NONE, 0, 0, 0 };
+
+#if defined(GPIO_INTERRUPT)
+
+#if defined(ARDUINO_ARCH_ESP32)
+#define GPIO_INTERRUPT_ATTRIBUTE IRAM_ATTR ///< ISR in IRAM, safe while flash cache is disabled
+#else
+#define GPIO_INTERRUPT_ATTRIBUTE
+#endif // ARDUINO_ARCH_ESP32
+
+static void GPIO_INTERRUPT_ATTRIBUTE h_GPIO_edge()
 {
-    while (hV_HAL_GPIO_get(pin) != state)
+    h_waitGPIO.flagEdge = true;
+}
+
+#endif // GPIO_INTERRUPT
+
+///
+/// @brief Sleep until next interrupt
+/// @note yield() on other platforms
+///
+static void h_GPIO_sleep()
+{
+#if defined(__AVR__)
+
+    set_sleep_mode(SLEEP_MODE_IDLE); // Timer and pin interrupts kept
+    sleep_enable();
+    sleep_cpu();
+    sleep_disable();
+
+#elif defined(__arm__) && !defined(hV_HAL_HOST)
+
+    __asm__ volatile ("wfi"); // Woken up by SysTick at least
+
+#else
+
+    yield();
+
+#endif // Platform
+}
+
+///
+/// @brief Stop the GPIO wait
+/// @param status WAIT_DONE or WAIT_TIMEOUT
+///
+static void h_GPIO_stopWait(uint8_t status)
+{
+#if defined(GPIO_INTERRUPT)
+
+    if (h_waitGPIO.flagInterrupt)
+    {
+        detachInterrupt(digitalPinToInterrupt(h_waitGPIO.pin));
+        h_waitGPIO.flagInterrupt = false;
+    }
+
+#endif // GPIO_INTERRUPT
+
+    h_waitGPIO.status = status;
+    hV_HAL_TRACE_RECORD(TRACE_WAIT_END, h_waitGPIO.pin, h_waitGPIO.state);
+}
+
+void hV_HAL_GPIO_startWait(uint8_t pin, uint8_t state, uint32_t timeout, void (* callback)(uint8_t status))
+{
+    if (h_waitGPIO.status == WAIT_ONGOING)
+    {
+        h_GPIO_stopWait(WAIT_NONE); // Cancelled, no callback
+    }
+
+    hV_HAL_TRACE_RECORD(TRACE_WAIT_BEGIN, pin, state);
+
+    h_waitGPIO.flagEdge = false;
+    h_waitGPIO.flagInterrupt = false;
+    h_waitGPIO.pin = pin;
+    h_waitGPIO.state = state;
+    h_waitGPIO.status = WAIT_ONGOING;
+    h_waitGPIO.start = hV_HAL_getMilliseconds();
+    h_waitGPIO.timeout = timeout;
+    h_waitGPIO.callback = callback;
+
+#if defined(GPIO_INTERRUPT)
+
+    int number = digitalPinToInterrupt(pin);
+
+#if defined(NOT_AN_INTERRUPT)
+
+    if (number != NOT_AN_INTERRUPT)
+
+#endif // NOT_AN_INTERRUPT
+    {
+        attachInterrupt(number, h_GPIO_edge, (state == HIGH) ? RISING : FALLING);
+        h_waitGPIO.flagInterrupt = true;
+
+        // State reached before the interrupt was attached
+        if (hV_HAL_GPIO_get(pin) == state)
+        {
+            h_waitGPIO.flagEdge = true;
+        }
+    }
+
+#endif // GPIO_INTERRUPT
+}
+
+uint8_t hV_HAL_GPIO_checkWait()
+{
+    if (h_waitGPIO.status != WAIT_ONGOING)
+    {
+        return h_waitGPIO.status;
+    }
+
+    bool flagReached;
+    if (h_waitGPIO.flagInterrupt)
+    {
+        flagReached = h_waitGPIO.flagEdge;
+    }
+    else
+    {
+        flagReached = (hV_HAL_GPIO_get(h_waitGPIO.pin) == h_waitGPIO.state);
+    }
+
+    if (flagReached)
+    {
+        h_GPIO_stopWait(WAIT_DONE);
+    }
+    else if ((h_waitGPIO.timeout > 0) and (hV_HAL_getMilliseconds() - h_waitGPIO.start >= h_waitGPIO.timeout))
+    {
+        h_GPIO_stopWait(WAIT_TIMEOUT);
+    }
+    else
     {
-        hV_HAL_delayMilliseconds(32); // non-blocking
+        return WAIT_ONGOING;
+    }
+
+    void (* callback)(uint8_t status) = h_waitGPIO.callback;
+    h_waitGPIO.callback = 0;
+    if (callback != 0)
+    {
+        callback(h_waitGPIO.status);
+    }
+    return h_waitGPIO.status;
+}
+
+uint8_t hV_HAL_GPIO_waitForTimeout(uint8_t pin, uint8_t state, uint32_t timeout, bool flagSleep)
+{
+    hV_HAL_GPIO_startWait(pin, state, timeout);
+
+    uint8_t status;
+    while ((status = hV_HAL_GPIO_checkWait()) == WAIT_ONGOING)
+    {
+        if (h_waitGPIO.flagInterrupt == false)
+        {
+            hV_HAL_delayMilliseconds(WAIT_POLL_PERIOD); // Polling fallback
+        }
+        else if (flagSleep)
+        {
+            h_GPIO_sleep();
+        }
+        else
+        {
+            yield();
+        }
     }
+    return status;
 }
+
+void hV_HAL_GPIO_waitFor(uint8_t pin, uint8_t state)
+{
+    hV_HAL_GPIO_waitForTimeout(pin, state, 0, false);
+}
+
+#if defined(hV_HAL_TRACE)
+
+uint8_t hV_HAL_GPIO_readTrace(uint8_t pin)
+{
+    uint8_t level = digitalRead(pin);
+    hV_HAL_Trace_record(TRACE_GPIO_READ, pin, level);
+    return level;
+}
+
+#endif // hV_HAL_TRACE
 //
 // === End of GPIO section
 //
@@ -175,18 +474,87 @@ void hV_HAL_GPIO_waitFor(uint8_t pin, uint8_t state)
 //
 bool flagSPI = false; // Some SPI implementations require unique initialisation
 
+///
+/// @brief State of the asynchronous write
+///
+struct h_asyncSPI_t
+{
+    volatile bool flagBusy; ///< true = transfer ongoing
+    void (* callback)(void); ///< called on completion
+};
+
+h_asyncSPI_t h_asyncSPI = { false, 0 };
+
+///
+/// @brief Apply settings to the bus
+/// @param setting settings
+///
+static void h_SPI_applySetting(h_settingSPI_t & setting)
+{
+#if defined(ENERGIA) // ENERGIA
+
+    SPI.setBitOrder(setting.bitOrder);
+    SPI.setDataMode(setting.dataMode);
+    SPI.setClockDivider(SPI_CLOCK_MAX / min(SPI_CLOCK_MAX, setting.clock));
+
+#else  // ARDUINO
+
+    if (h_profileSPI.flagTransaction)
+    {
+        SPI.endTransaction();
+    }
+    SPI.beginTransaction(setting);
+    h_profileSPI.flagTransaction = true;
+
+#endif // ENERGIA
+}
+
+///
+/// @brief Apply the settings of a profile to the bus
+/// @param profile SPI_PROFILE_COMMAND, SPI_PROFILE_DATA or SPI_PROFILE_READBACK
+///
+static void h_SPI_apply(uint8_t profile)
+{
+    h_SPI_applySetting(h_profileSPI.setting[profile]);
+    h_profileSPI.active = profile;
+    h_busSPI.applied = SPI_DEVICE_PANEL;
+}
+
+///
+/// @brief Apply the settings of a device to the bus
+/// @param device SPI_DEVICE_PANEL, SPI_DEVICE_FLASH or SPI_DEVICE_CARD
+/// @note SPI_DEVICE_PANEL uses the active SPI clock profile
+///
+static void h_SPI_applyDevice(uint8_t device)
+{
+    if (h_busSPI.applied != device)
+    {
+        if (device == SPI_DEVICE_PANEL)
+        {
+            h_SPI_apply(h_profileSPI.active);
+        }
+        else
+        {
+            h_SPI_applySetting(h_busSPI.device[device].setting);
+            h_busSPI.applied = device;
+        }
+    }
+}
+
 void hV_HAL_SPI_begin(uint32_t speed)
 {
     if (flagSPI != true)
     {
-        _settingScreen = {speed, MSBFIRST, SPI_MODE0};
+        for (uint8_t profile = 0; profile < SPI_PROFILE_NUMBER; profile++)
+        {
+            h_profileSPI.setting[profile] = {speed, MSBFIRST, SPI_MODE0};
+            h_profileSPI.speed[profile] = speed;
+        }
+        h_profileSPI.flagTransaction = false;
 
 #if defined(ENERGIA) // ENERGIA
 
         SPI.begin();
-        SPI.setBitOrder(_settingScreen.bitOrder);
-        SPI.setDataMode(_settingScreen.dataMode);
-        SPI.setClockDivider(SPI_CLOCK_MAX / min(SPI_CLOCK_MAX, _settingScreen.clock));
 
 #else  // ARDUINO
 
@@ -217,10 +585,10 @@ void hV_HAL_SPI_begin(uint32_t speed)
 
 #endif // SPI specifics
 
-        SPI.beginTransaction(_settingScreen);
-
 #endif // ENERGIA
 
+        h_SPI_apply(SPI_PROFILE_COMMAND);
+
         flagSPI = true;
     }
 }
@@ -229,16 +597,420 @@ void hV_HAL_SPI_end()
 {
     if (flagSPI != false)
     {
+        hV_HAL_SPI_waitAsync();
+
+#if !defined(ENERGIA)
+
+        if (h_profileSPI.flagTransaction)
+        {
+            SPI.endTransaction();
+            h_profileSPI.flagTransaction = false;
+        }
+
+#endif // ENERGIA
+
         SPI.end();
         flagSPI = false;
     }
 }
 
+void hV_HAL_SPI_setProfile(uint8_t profile, uint32_t speed)
+{
+    if (profile >= SPI_PROFILE_NUMBER)
+    {
+        return;
+    }
+
+    h_profileSPI.setting[profile] = {speed, MSBFIRST, SPI_MODE0};
+    h_profileSPI.speed[profile] = speed;
+
+    // Active profile updated
+    if ((flagSPI == true) and (profile == h_profileSPI.active) and (h_busSPI.applied == SPI_DEVICE_PANEL))
+    {
+        hV_HAL_SPI_waitAsync();
+        h_SPI_apply(profile);
+    }
+}
+
+void hV_HAL_SPI_selectProfile(uint8_t profile)
+{
+    if ((profile >= SPI_PROFILE_NUMBER) or (profile == h_profileSPI.active))
+    {
+        return;
+    }
+
+    // Same speed, no bus change required
+    if (h_profileSPI.speed[profile] == h_profileSPI.speed[h_profileSPI.active])
+    {
+        h_profileSPI.active = profile;
+        return;
+    }
+
+    if ((flagSPI == true) and (h_busSPI.applied == SPI_DEVICE_PANEL))
+    {
+        hV_HAL_SPI_waitAsync();
+        h_SPI_apply(profile);
+    }
+    else
+    {
+        // Applied when the panel gets the bus back
+        h_profileSPI.active = profile;
+    }
+}
+
+uint8_t hV_HAL_SPI_getProfile()
+{
+    return h_profileSPI.active;
+}
+
+uint32_t hV_HAL_SPI_getSpeed(uint8_t profile)
+{
+    return (profile < SPI_PROFILE_NUMBER) ? h_profileSPI.speed[profile] : 0;
+}
+
+void hV_HAL_SPI_defineDevice(uint8_t device, uint8_t pinCS, uint32_t speed, uint8_t mode)
+{
+    if (device >= SPI_DEVICE_NUMBER)
+    {
+        return;
+    }
+
+    h_busSPI.device[device].setting = {speed, MSBFIRST, mode};
+    h_busSPI.device[device].pinCS = pinCS;
+    h_busSPI.device[device].depth = 0;
+
+    if (pinCS != 0xff) // NOT_CONNECTED
+    {
+        hV_HAL_GPIO_define(pinCS, OUTPUT);
+        hV_HAL_GPIO_set(pinCS); // Unselect
+    }
+
+    // Settings re-applied at next acquisition
+    if (h_busSPI.applied == device)
+    {
+        h_busSPI.applied = SPI_DEVICE_NONE;
+    }
+}
+
+uint8_t hV_HAL_SPI_acquire(uint8_t device)
+{
+    uint8_t previous = h_busSPI.owner;
+
+    if (device >= SPI_DEVICE_NUMBER)
+    {
+        return previous;
+    }
+
+    // Same owner, grouped operations
+    if (previous == device)
+    {
+        h_busSPI.device[device].depth += 1;
+        return previous;
+    }
+
+    if (previous != SPI_DEVICE_NONE)
+    {
+        // Device already preempted, re-entry refused
+        for (uint8_t index = 0; index < h_busSPI.count; index++)
+        {
+            if (h_busSPI.stack[index] == device)
+            {
+                return SPI_DEVICE_REFUSED;
+            }
+        }
+
+        // Owner with /CS managed by the caller, cannot be unselected
+        if ((h_busSPI.device[previous].pinCS == 0xff) or (h_busSPI.count >= SPI_DEVICE_NUMBER)) // NOT_CONNECTED
+        {
+            return SPI_DEVICE_REFUSED;
+        }
+    }
+
+    hV_HAL_SPI_waitAsync();
+
+    // Another device holds the bus, preempted at chunk boundary
+    if (previous != SPI_DEVICE_NONE)
+    {
+        hV_HAL_GPIO_set(h_busSPI.device[previous].pinCS); // Unselect
+        h_busSPI.stack[h_busSPI.count] = previous;
+        h_busSPI.count += 1;
+    }
+
+    h_busSPI.owner = device;
+    h_busSPI.device[device].depth = 1;
+    if (flagSPI == true)
+    {
+        h_SPI_applyDevice(device);
+    }
+
+    if (h_busSPI.device[device].pinCS != 0xff) // NOT_CONNECTED
+    {
+        hV_HAL_GPIO_clear(h_busSPI.device[device].pinCS); // Select
+    }
+
+    return previous;
+}
+
+void hV_HAL_SPI_release(uint8_t device)
+{
+    if ((device >= SPI_DEVICE_NUMBER) or (h_busSPI.owner != device))
+    {
+        return;
+    }
+
+    h_busSPI.device[device].depth -= 1;
+    if (h_busSPI.device[device].depth > 0)
+    {
+        return;
+    }
+
+    hV_HAL_SPI_waitAsync();
+
+    if (h_busSPI.device[device].pinCS != 0xff) // NOT_CONNECTED
+    {
+        hV_HAL_GPIO_set(h_busSPI.device[device].pinCS); // Unselect
+    }
+    h_busSPI.owner = SPI_DEVICE_NONE;
+
+    // Resume preempted device
+    if (h_busSPI.count > 0)
+    {
+        h_busSPI.count -= 1;
+        uint8_t resumed = h_busSPI.stack[h_busSPI.count];
+        h_busSPI.owner = resumed;
+        if (flagSPI == true)
+        {
+            h_SPI_applyDevice(resumed);
+        }
+
+        if (h_busSPI.device[resumed].pinCS != 0xff) // NOT_CONNECTED
+        {
+            hV_HAL_GPIO_clear(h_busSPI.device[resumed].pinCS); // Select
+        }
+    }
+}
+
+uint8_t hV_HAL_SPI_getOwner()
+{
+    return h_busSPI.owner;
+}
+
 uint8_t hV_HAL_SPI_transfer(uint8_t data)
 {
+    if (h_asyncSPI.flagBusy)
+    {
+        hV_HAL_SPI_waitAsync();
+    }
+
+    hV_HAL_TRACE_RECORD(TRACE_SPI_BYTE, 0, data);
     return SPI.transfer(data);
 }
 
+void hV_HAL_SPI_writeBuffer(const uint8_t * data, uint32_t size)
+{
+    if (h_asyncSPI.flagBusy)
+    {
+        hV_HAL_SPI_waitAsync();
+    }
+
+    hV_HAL_TRACE_RECORD(TRACE_SPI_BEGIN, 0, size);
+
+#if defined(ARDUINO_ARCH_ESP32)
+
+    // Write-only, no read-back
+    SPI.writeBytes(data, size);
+
+#elif (defined(ARDUINO_ARCH_RP2040) && !defined(ARDUINO_ARCH_MBED)) || defined(hV_HAL_HOST)
+
+    // Write-only, no read-back
+    SPI.transfer(data, nullptr, size);
+
+#elif defined(ENERGIA)
+
+    // Fallback, byte per byte
+    for (uint32_t index = 0; index < size; index++)
+    {
+        SPI.transfer(data[index]);
+    }
+
+#else // ARDUINO
+
+    // SPI.transfer() overwrites the buffer with read data
+    uint8_t chunk[SPI_CHUNK_LENGTH];
+
+    while (size > 0)
+    {
+        uint32_t length = hV_HAL_min(size, (uint32_t)SPI_CHUNK_LENGTH);
+        memcpy(chunk, data, length);
+        SPI.transfer(chunk, length);
+        data += length;
+        size -= length;
+    }
+
+#endif // SPI specifics
+
+    hV_HAL_TRACE_RECORD(TRACE_SPI_END, 0, 0);
+}
+
+void hV_HAL_SPI_readBuffer(uint8_t * data, uint32_t size)
+{
+    if (h_asyncSPI.flagBusy)
+    {
+        hV_HAL_SPI_waitAsync();
+    }
+
+    hV_HAL_TRACE_RECORD(TRACE_SPI_BEGIN, 0, size);
+
+#if defined(ENERGIA)
+
+    // Fallback, byte per byte
+    for (uint32_t index = 0; index < size; index++)
+    {
+        data[index] = SPI.transfer(0x00);
+    }
+
+#else // ARDUINO
+
+    // SPI.transfer() overwrites the buffer with read data
+    memset(data, 0x00, size);
+    SPI.transfer(data, size);
+
+#endif // SPI specifics
+
+    hV_HAL_TRACE_RECORD(TRACE_SPI_END, 0, 0);
+}
+
+void hV_HAL_SPI_writeFixed(uint8_t data, uint32_t size)
+{
+    if (h_asyncSPI.flagBusy)
+    {
+        hV_HAL_SPI_waitAsync();
+    }
+
+    hV_HAL_TRACE_RECORD(TRACE_SPI_BEGIN, 0, size);
+
+#if defined(ARDUINO_ARCH_ESP32)
+
+    // Write-only, pattern repeated by the SDK
+    SPI.writePattern(&data, 1, size);
+
+#elif (defined(ARDUINO_ARCH_RP2040) && !defined(ARDUINO_ARCH_MBED)) || defined(hV_HAL_HOST)
+
+    // Write-only, pattern buffer kept between calls
+    static uint8_t pattern[SPI_CHUNK_LENGTH];
+    static bool flagPattern = false;
+
+    if ((flagPattern == false) or (pattern[0] != data))
+    {
+        memset(pattern, data, sizeof(pattern));
+        flagPattern = true;
+    }
+
+    while (size > 0)
+    {
+        uint32_t length = hV_HAL_min(size, (uint32_t)SPI_CHUNK_LENGTH);
+        SPI.transfer(pattern, nullptr, length);
+        size -= length;
+    }
+
+#elif defined(ENERGIA)
+
+    // Fallback, byte per byte
+    for (uint32_t index = 0; index < size; index++)
+    {
+        SPI.transfer(data);
+    }
+
+#else // ARDUINO
+
+    // SPI.transfer() overwrites the buffer with read data
+    uint8_t chunk[SPI_CHUNK_LENGTH];
+
+    while (size > 0)
+    {
+        uint32_t length = hV_HAL_min(size, (uint32_t)SPI_CHUNK_LENGTH);
+        memset(chunk, data, length);
+        SPI.transfer(chunk, length);
+        size -= length;
+    }
+
+#endif // SPI specifics
+
+    hV_HAL_TRACE_RECORD(TRACE_SPI_END, 0, 0);
+}
+
+void hV_HAL_SPI_writeAsync(const uint8_t * data, uint32_t size, void (* callback)(void))
+{
+    if (h_asyncSPI.flagBusy)
+    {
+        hV_HAL_SPI_waitAsync();
+    }
+
+    h_asyncSPI.callback = callback;
+
+#if (defined(ARDUINO_ARCH_RP2040) && !defined(ARDUINO_ARCH_MBED)) || defined(hV_HAL_HOST)
+
+    // DMA, write-only
+    h_asyncSPI.flagBusy = SPI.transferAsync(data, nullptr, size);
+    if (h_asyncSPI.flagBusy)
+    {
+        hV_HAL_TRACE_RECORD(TRACE_SPI_BEGIN, 0, size);
+        return;
+    }
+
+    // DMA not available, fallback
+    hV_HAL_SPI_writeBuffer(data, size);
+
+#else // No DMA
+
+    hV_HAL_SPI_writeBuffer(data, size);
+
+#endif // SPI specifics
+
+    // Completed synchronously
+    h_asyncSPI.callback = 0;
+    if (callback != 0)
+    {
+        callback();
+    }
+}
+
+bool hV_HAL_SPI_isAsyncDone()
+{
+    if (h_asyncSPI.flagBusy == false)
+    {
+        return true;
+    }
+
+#if (defined(ARDUINO_ARCH_RP2040) && !defined(ARDUINO_ARCH_MBED)) || defined(hV_HAL_HOST)
+
+    if (SPI.finishedAsync() == false)
+    {
+        return false;
+    }
+
+#endif // SPI specifics
+
+    h_asyncSPI.flagBusy = false;
+    hV_HAL_TRACE_RECORD(TRACE_SPI_END, 0, 0);
+
+    void (* callback)(void) = h_asyncSPI.callback;
+    h_asyncSPI.callback = 0;
+    if (callback != 0)
+    {
+        callback();
+    }
+    return true;
+}
+
+void hV_HAL_SPI_waitAsync()
+{
+    while (hV_HAL_SPI_isAsyncDone() == false)
+    {
+        yield();
+    }
+}
+
 //
 // === End of SPI section
 //
@@ -248,55 +1020,229 @@ uint8_t hV_HAL_SPI_transfer(uint8_t data)
 //
 void hV_HAL_SPI3_begin()
 {
-    ;
+    // Pins possibly reconfigured by SPI.begin() or other code
+    h_pinSPI3.flagClock = false;
+    h_pinSPI3.modeData = SPI3_MODE_NONE;
 }
 
 void hV_HAL_SPI3_end()
 {
     hV_HAL_GPIO_undefine(h_pinSPI3.pinClock);
     hV_HAL_GPIO_undefine(h_pinSPI3.pinData);
+    h_pinSPI3.flagClock = false;
+    h_pinSPI3.modeData = SPI3_MODE_NONE;
 }
 
 void hV_HAL_SPI3_define(uint8_t pinClock, uint8_t pinData)
 {
     h_pinSPI3.pinClock = pinClock;
     h_pinSPI3.pinData = pinData;
+    h_pinSPI3.flagClock = false;
+    h_pinSPI3.modeData = SPI3_MODE_NONE;
+
+#if defined(SPI3_PORT_ACCESS)
+
+    // Resolved once
+#if defined(ARDUINO_ARCH_SAMD)
+
+    h_pinSPI3.clockSet = &(digitalPinToPort(pinClock)->OUTSET.reg);
+    h_pinSPI3.clockClear = &(digitalPinToPort(pinClock)->OUTCLR.reg);
+    h_pinSPI3.dataSet = &(digitalPinToPort(pinData)->OUTSET.reg);
+    h_pinSPI3.dataClear = &(digitalPinToPort(pinData)->OUTCLR.reg);
+
+#else
+
+    h_pinSPI3.clockOut = portOutputRegister(digitalPinToPort(pinClock));
+    h_pinSPI3.dataOut = portOutputRegister(digitalPinToPort(pinData));
+
+#endif // ARDUINO_ARCH_SAMD
+
+    h_pinSPI3.clockMask = digitalPinToBitMask(pinClock);
+    h_pinSPI3.dataIn = portInputRegister(digitalPinToPort(pinData));
+    h_pinSPI3.dataMask = digitalPinToBitMask(pinData);
+
+#endif // SPI3_PORT_ACCESS
 }
 
-uint8_t hV_HAL_SPI3_read()
+void hV_HAL_SPI3_setFrequency(uint32_t frequency)
 {
-    uint8_t value = 0;
+    // Clamped for frequencies below 8 Hz
+    h_pinSPI3.halfBit = (frequency > 0) ? hV_HAL_min((uint32_t)(500000 / frequency), (uint32_t)0xffff) : 1;
+}
 
-    pinMode(h_pinSPI3.pinClock, OUTPUT);
-    pinMode(h_pinSPI3.pinData, INPUT);
+///
+/// @brief Configure the 3-wire SPI pins
+/// @param modeData INPUT or OUTPUT
+/// @note pinMode() only called on change
+///
+static void h_SPI3_prepare(uint8_t modeData)
+{
+    if (h_pinSPI3.flagClock == false)
+    {
+        pinMode(h_pinSPI3.pinClock, OUTPUT);
+        h_pinSPI3.flagClock = true;
+    }
 
-    for (uint8_t i = 0; i < 8; ++i)
+    if (h_pinSPI3.modeData != modeData)
     {
-        digitalWrite(h_pinSPI3.pinClock, HIGH);
-        delayMicroseconds(1);
-        value |= digitalRead(h_pinSPI3.pinData) << (7 - i);
-        digitalWrite(h_pinSPI3.pinClock, LOW);
-        delayMicroseconds(1);
+        pinMode(h_pinSPI3.pinData, modeData);
+        h_pinSPI3.modeData = modeData;
     }
+}
 
-    return value;
+static inline void h_SPI3_wait()
+{
+    if (h_pinSPI3.halfBit > 0)
+    {
+        delayMicroseconds(h_pinSPI3.halfBit);
+    }
 }
 
-void hV_HAL_SPI3_write(uint8_t value)
+static inline void h_SPI3_clock(bool level)
+{
+#if defined(SPI3_PORT_ACCESS)
+
+#if defined(ARDUINO_ARCH_SAMD)
+
+    // Set and clear registers, no read-modify-write
+    if (level)
+    {
+        *h_pinSPI3.clockSet = h_pinSPI3.clockMask;
+    }
+    else
+    {
+        *h_pinSPI3.clockClear = h_pinSPI3.clockMask;
+    }
+
+#else
+
+    // Read-modify-write, protected from interrupts writing the same port
+    ATOMIC_BLOCK(ATOMIC_RESTORESTATE)
+    {
+        if (level)
+        {
+            *h_pinSPI3.clockOut |= h_pinSPI3.clockMask;
+        }
+        else
+        {
+            *h_pinSPI3.clockOut &= ~h_pinSPI3.clockMask;
+        }
+    }
+
+#endif // ARDUINO_ARCH_SAMD
+
+#else
+
+    digitalWrite(h_pinSPI3.pinClock, level);
+
+#endif // SPI3_PORT_ACCESS
+}
+
+static inline void h_SPI3_writeData(bool level)
+{
+#if defined(SPI3_PORT_ACCESS)
+
+#if defined(ARDUINO_ARCH_SAMD)
+
+    // Set and clear registers, no read-modify-write
+    if (level)
+    {
+        *h_pinSPI3.dataSet = h_pinSPI3.dataMask;
+    }
+    else
+    {
+        *h_pinSPI3.dataClear = h_pinSPI3.dataMask;
+    }
+
+#else
+
+    // Read-modify-write, protected from interrupts writing the same port
+    ATOMIC_BLOCK(ATOMIC_RESTORESTATE)
+    {
+        if (level)
+        {
+            *h_pinSPI3.dataOut |= h_pinSPI3.dataMask;
+        }
+        else
+        {
+            *h_pinSPI3.dataOut &= ~h_pinSPI3.dataMask;
+        }
+    }
+
+#endif // ARDUINO_ARCH_SAMD
+
+#else
+
+    digitalWrite(h_pinSPI3.pinData, level);
+
+#endif // SPI3_PORT_ACCESS
+}
+
+static inline uint8_t h_SPI3_readData()
+{
+#if defined(SPI3_PORT_ACCESS)
+
+    return ((*h_pinSPI3.dataIn & h_pinSPI3.dataMask) != 0) ? 1 : 0;
+
+#else
+
+    return (digitalRead(h_pinSPI3.pinData) == HIGH) ? 1 : 0;
+
+#endif // SPI3_PORT_ACCESS
+}
+
+void hV_HAL_SPI3_readBlock(uint8_t * data, uint32_t size)
 {
-    pinMode(h_pinSPI3.pinClock, OUTPUT);
-    pinMode(h_pinSPI3.pinData, OUTPUT);
+    h_SPI3_prepare(INPUT);
 
-    for (uint8_t i = 0; i < 8; i++)
+    for (uint32_t index = 0; index < size; index++)
     {
-        digitalWrite(h_pinSPI3.pinData, !!(value & (1 << (7 - i))));
-        delayMicroseconds(1);
-        digitalWrite(h_pinSPI3.pinClock, HIGH);
-        delayMicroseconds(1);
-        digitalWrite(h_pinSPI3.pinClock, LOW);
-        delayMicroseconds(1);
+        uint8_t value = 0;
+
+        for (uint8_t i = 0; i < 8; ++i)
+        {
+            h_SPI3_clock(HIGH);
+            h_SPI3_wait();
+            value |= h_SPI3_readData() << (7 - i);
+            h_SPI3_clock(LOW);
+            h_SPI3_wait();
+        }
+
+        data[index] = value;
+    }
+}
+
+void hV_HAL_SPI3_writeBlock(const uint8_t * data, uint32_t size)
+{
+    h_SPI3_prepare(OUTPUT);
+
+    for (uint32_t index = 0; index < size; index++)
+    {
+        uint8_t value = data[index];
+
+        for (uint8_t i = 0; i < 8; i++)
+        {
+            h_SPI3_writeData(!!(value & (1 << (7 - i))));
+            h_SPI3_wait();
+            h_SPI3_clock(HIGH);
+            h_SPI3_wait();
+            h_SPI3_clock(LOW);
+            h_SPI3_wait();
+        }
     }
 }
+
+uint8_t hV_HAL_SPI3_read()
+{
+    uint8_t value = 0;
+    hV_HAL_SPI3_readBlock(&value, 1);
+    return value;
+}
+
+void hV_HAL_SPI3_write(uint8_t value)
+{
+    hV_HAL_SPI3_writeBlock(&value, 1);
+}
 //
 // === End of 3-wire SPI section
 //
@@ -371,13 +1317,13 @@ uint8_t hV_HAL_Wire_transfer(uint8_t address, uint8_t * dataWrite, size_t sizeWr
         memset(dataRead, 0x00, sizeRead);
         Wire.requestFrom(address, sizeRead);
         uint8_t count = 8;
-        while ((Wire.available() < sizeRead) and (count > 0))
+        while (((size_t)Wire.available() < sizeRead) and (count > 0))
         {
             delay(4);
             count -= 1;
         }
 
-        if ((count == 0) and (Wire.available() < sizeRead))
+        if ((count == 0) and ((size_t)Wire.available() < sizeRead))
         {
             // hV_HAL_log(LEVEL_ERROR, "I2C device 0x%02x overtime", address);
             return 1;
@@ -441,17 +1387,11 @@ void hV_HAL_log(uint16_t level, const char * format, ...)
     // #define LEVEL_DEBUG 0x0010 ///< `-` Debug
     // #define LEVEL_SYSTEM 0x0020 ///< `=` System
 
-    char buffer[LOG_TEXT_LENGTH] = {0x00};
-
-    // Content
-    char * frame = &buffer[strlen(buffer)];
+    // Immediate output, or deferred with hV_HAL_LOG_DEFERRED
     va_list args;
     va_start(args, format);
-    vsnprintf(frame, 255, format, args);
+    hV_HAL_Log_recordList(level, format, args);
     va_end(args);
-
-    hV_HAL_Serial.print("hV _ ");
-    hV_HAL_Serial.println(buffer);
 }
 //
 // === End of Log system
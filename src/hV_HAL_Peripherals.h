@@ -4,8 +4,8 @@
 ///
 /// @details Based on highView technology
 ///
-/// @date 21 Dec 2025
-/// @version 1001
+/// @date 17 Oct 2026
+/// @version 1002
 ///
 /// @copyright (c) Pervasive Displays Inc., 2021-2025
 /// @copyright (c) Etigues, 2010-2025
@@ -58,7 +58,22 @@
 ///
 /// @brief Release
 ///
-#define hV_HAL_PERIPHERALS_RELEASE 1001
+#define hV_HAL_PERIPHERALS_RELEASE 1002
+
+///
+/// @brief Host back-end
+/// @details Linux without Arduino SDK
+/// @see hV_HAL_Host.h
+///
+#if defined(__linux__) && !defined(ARDUINO)
+#define hV_HAL_HOST
+#endif // __linux__ ARDUINO
+
+#if defined(hV_HAL_HOST)
+
+#include "hV_HAL_Host.h"
+
+#else
 
 ///
 /// @brief SDK library
@@ -81,6 +96,8 @@
 #include <SPI.h>
 #include <Wire.h>
 
+#endif // hV_HAL_HOST
+
 ///
 /// @brief Other libraries
 ///
@@ -88,6 +105,28 @@
 #include <stdio.h>
 #include <stdarg.h>
 
+///
+/// @brief Trace recorder
+/// @details Compiled out unless hV_HAL_TRACE is defined
+/// @see hV_HAL_Trace.h
+///
+#include "hV_HAL_Trace.h"
+
+#if (hV_HAL_TRACE_RELEASE < 1000)
+#error Required hV_HAL_TRACE_RELEASE 1000
+#endif // hV_HAL_TRACE_RELEASE
+
+///
+/// @brief Deferred log
+/// @details Immediate output unless hV_HAL_LOG_DEFERRED is defined
+/// @see hV_HAL_Log.h
+///
+#include "hV_HAL_Log.h"
+
+#if (hV_HAL_LOG_RELEASE < 1000)
+#error Required hV_HAL_LOG_RELEASE 1000
+#endif // hV_HAL_LOG_RELEASE
+
 ///
 /// @brief Serial port
 /// @details Serial or Serial1
@@ -111,7 +150,7 @@ void hV_HAL_begin();
 ///
 /// @brief General exit
 /// @param code default = 0 = success, otherwise error
-/// @note Only used on Linux
+/// @note Only used on Linux, including the host back-end
 ///
 void hV_HAL_exit(uint8_t code = 0);
 
@@ -126,6 +165,24 @@ void hV_HAL_exit(uint8_t code = 0);
 /// * Mbed: GPIO not suitable for interrupts
 /// * Viewer: For compatibility only, GPIO not implemented in Linux
 /// @{
+#if defined(hV_HAL_TRACE)
+
+#define hV_HAL_GPIO_define(X, Y) (pinMode(X, Y))
+#define hV_HAL_GPIO_set(X) (hV_HAL_Trace_record(TRACE_GPIO_WRITE, X, HIGH), digitalWrite(X, HIGH))
+#define hV_HAL_GPIO_clear(X) (hV_HAL_Trace_record(TRACE_GPIO_WRITE, X, LOW), digitalWrite(X, LOW))
+#define hV_HAL_GPIO_get(X) (hV_HAL_GPIO_readTrace(X))
+#define hV_HAL_GPIO_write(X, Y) (hV_HAL_Trace_record(TRACE_GPIO_WRITE, X, Y), digitalWrite(X, Y))
+#define hV_HAL_GPIO_read(X) (hV_HAL_GPIO_readTrace(X))
+
+///
+/// @brief Read GPIO and record
+/// @param pin pin number or pin name according to SDK
+/// @return HIGH or LOW
+///
+uint8_t hV_HAL_GPIO_readTrace(uint8_t pin);
+
+#else
+
 #define hV_HAL_GPIO_define(X, Y) (pinMode(X, Y))
 #define hV_HAL_GPIO_set(X) (digitalWrite(X, HIGH))
 #define hV_HAL_GPIO_clear(X) (digitalWrite(X, LOW))
@@ -133,6 +190,8 @@ void hV_HAL_exit(uint8_t code = 0);
 #define hV_HAL_GPIO_write(X, Y) (digitalWrite(X, Y))
 #define hV_HAL_GPIO_read(X) (digitalRead(X))
 
+#endif // hV_HAL_TRACE
+
 void hV_HAL_GPIO_begin(void);
 
 ///
@@ -147,9 +206,59 @@ void hV_HAL_GPIO_undefine(uint8_t pin);
 ///
 /// @param pin pin number or pin name according to SDK
 /// @param state HIGH or LOW
+/// @note Same as hV_HAL_GPIO_waitForTimeout() without timeout nor sleep
 ///
 void hV_HAL_GPIO_waitFor(uint8_t pin, uint8_t state);
 
+///
+/// @name Status of GPIO wait
+/// @note Numbers are sequential and exclusive
+/// @{
+#define WAIT_NONE 0x00 ///< No wait started
+#define WAIT_ONGOING 0x01 ///< State not reached yet
+#define WAIT_DONE 0x02 ///< State reached
+#define WAIT_TIMEOUT 0x03 ///< Timeout before state reached
+/// @}
+
+///
+/// @brief Period for polling fallback, ms
+///
+#define WAIT_POLL_PERIOD 32
+
+///
+/// @brief Wait for GPIO, with timeout
+///
+/// @param pin pin number or pin name according to SDK
+/// @param state HIGH or LOW
+/// @param timeout maximum duration in ms, default = 0 = none
+/// @param flagSleep true = MCU sleep between interrupts, default = false = yield()
+/// @return WAIT_DONE or WAIT_TIMEOUT
+/// @note Edge-triggered if the pin supports interrupts
+/// * AVR: idle sleep mode
+/// * ARM: wait for interrupt
+/// @note Polling every WAIT_POLL_PERIOD ms as fallback
+/// * Energia, host back-end and pins without interrupt
+///
+uint8_t hV_HAL_GPIO_waitForTimeout(uint8_t pin, uint8_t state, uint32_t timeout = 0, bool flagSleep = false);
+
+///
+/// @brief Start waiting for GPIO, non-blocking
+///
+/// @param pin pin number or pin name according to SDK
+/// @param state HIGH or LOW
+/// @param timeout maximum duration in ms, default = 0 = none
+/// @param callback function called on completion with WAIT_DONE or WAIT_TIMEOUT, default = 0 = none
+/// @note Callback called when completion is detected by hV_HAL_GPIO_checkWait(), not from the interrupt
+/// @note A single wait at a time, a new wait cancels the ongoing one
+///
+void hV_HAL_GPIO_startWait(uint8_t pin, uint8_t state, uint32_t timeout = 0, void (* callback)(uint8_t status) = 0);
+
+///
+/// @brief Check the wait started by hV_HAL_GPIO_startWait()
+/// @return WAIT_NONE, WAIT_ONGOING, WAIT_DONE or WAIT_TIMEOUT
+///
+uint8_t hV_HAL_GPIO_checkWait();
+
 /// @}
 
 ///
@@ -157,8 +266,17 @@ void hV_HAL_GPIO_waitFor(uint8_t pin, uint8_t state);
 /// @see https://www.arduino.cc/reference/en/#time
 /// @{
 
+#if defined(hV_HAL_TRACE)
+
+#define hV_HAL_delayMilliseconds(X) (hV_HAL_Trace_record(TRACE_DELAY, 0, (X) * 1000), delay(X))
+#define hV_HAL_delayMicroseconds(X) (hV_HAL_Trace_record(TRACE_DELAY, 0, X), delayMicroseconds(X))
+
+#else
+
 #define hV_HAL_delayMilliseconds(X) (delay(X))
 #define hV_HAL_delayMicroseconds(X) (delayMicroseconds(X))
+
+#endif // hV_HAL_TRACE
 #define hV_HAL_getMilliseconds() (millis())
 /// @}
 
@@ -197,6 +315,8 @@ void hV_HAL_Serial_crlf(void);
 /// * Bit order: MSBFIRST
 /// * Data mode: SPI_MODE0
 /// @note With check for unique initialisation
+/// @note All the SPI clock profiles are set at speed, SPI_PROFILE_COMMAND selected
+/// @note Use hV_HAL_SPI_setProfile() to change the speed afterwards
 ///
 void hV_HAL_SPI_begin(uint32_t speed = 8000000);
 
@@ -206,6 +326,95 @@ void hV_HAL_SPI_begin(uint32_t speed = 8000000);
 ///
 void hV_HAL_SPI_end();
 
+///
+/// @name SPI clock profiles
+/// @note Numbers are sequential and exclusive
+/// @{
+#define SPI_PROFILE_COMMAND 0x00 ///< Commands and register writes, default
+#define SPI_PROFILE_DATA 0x01 ///< Bulk frame data
+#define SPI_PROFILE_READBACK 0x02 ///< Register and OTP read-back
+#define SPI_PROFILE_NUMBER 3 ///< Number of profiles
+/// @}
+
+///
+/// @brief Set the speed of a SPI clock profile
+/// @param profile SPI_PROFILE_COMMAND, SPI_PROFILE_DATA or SPI_PROFILE_READBACK
+/// @param speed SPI speed in Hz
+/// @note Settings object cached, applied immediately if the profile is active
+///
+void hV_HAL_SPI_setProfile(uint8_t profile, uint32_t speed);
+
+///
+/// @brief Select a SPI clock profile
+/// @param profile SPI_PROFILE_COMMAND, SPI_PROFILE_DATA or SPI_PROFILE_READBACK
+/// @note No bus change if the profile or its speed is already active
+/// @note Waits for the end of a pending asynchronous write
+///
+void hV_HAL_SPI_selectProfile(uint8_t profile);
+
+///
+/// @brief Get the active SPI clock profile
+/// @return SPI_PROFILE_COMMAND, SPI_PROFILE_DATA or SPI_PROFILE_READBACK
+///
+uint8_t hV_HAL_SPI_getProfile();
+
+///
+/// @brief Get the speed of a SPI clock profile
+/// @param profile SPI_PROFILE_COMMAND, SPI_PROFILE_DATA or SPI_PROFILE_READBACK
+/// @return SPI speed in Hz, 0 if no such profile
+/// @note For example, to restart the bus with the same profiles
+///
+uint32_t hV_HAL_SPI_getSpeed(uint8_t profile);
+
+///
+/// @name SPI devices on the shared bus
+/// @note Numbers are sequential and exclusive, except NONE and REFUSED
+/// @{
+#define SPI_DEVICE_PANEL 0x00 ///< Panel, with SPI clock profiles, default
+#define SPI_DEVICE_FLASH 0x01 ///< External SPI flash
+#define SPI_DEVICE_CARD 0x02 ///< External SD-card
+#define SPI_DEVICE_NUMBER 3 ///< Number of devices
+#define SPI_DEVICE_REFUSED 0xfe ///< Acquisition refused
+#define SPI_DEVICE_NONE 0xff ///< No device
+/// @}
+
+///
+/// @brief Define a device on the shared SPI bus
+/// @param device SPI_DEVICE_PANEL, SPI_DEVICE_FLASH or SPI_DEVICE_CARD
+/// @param pinCS /CS pin managed by the arbiter, NOT_CONNECTED = managed by the caller
+/// @param speed SPI speed in Hz, 8000000 = default
+/// @param mode SPI_MODE0 = default, SPI_MODE1, SPI_MODE2, SPI_MODE3
+/// @note For SPI_DEVICE_PANEL, speed and mode are ignored. Use hV_HAL_SPI_setProfile() instead.
+///
+void hV_HAL_SPI_defineDevice(uint8_t device, uint8_t pinCS, uint32_t speed = 8000000, uint8_t mode = SPI_MODE0);
+
+///
+/// @brief Acquire the shared SPI bus for a device
+/// @param device SPI_DEVICE_PANEL, SPI_DEVICE_FLASH or SPI_DEVICE_CARD
+/// @return previous owner, SPI_DEVICE_NONE if none, SPI_DEVICE_REFUSED if refused
+/// @note Acquisitions by the same device are nested, to group operations
+/// @note Acquisition by another device preempts the owner
+/// * Preempted device unselected and resumed with its settings and selected at release
+/// * Refused if the owner has /CS managed by the caller, release it before
+/// * Refused if the device is already preempted
+/// @warning Bus not acquired if refused, no transfer and no release
+/// @note Settings applied only if different from the current ones
+///
+uint8_t hV_HAL_SPI_acquire(uint8_t device);
+
+///
+/// @brief Release the shared SPI bus
+/// @param device SPI_DEVICE_PANEL, SPI_DEVICE_FLASH or SPI_DEVICE_CARD
+/// @note Effective after as many releases as acquisitions
+///
+void hV_HAL_SPI_release(uint8_t device);
+
+///
+/// @brief Get the device holding the shared SPI bus
+/// @return SPI_DEVICE_PANEL, SPI_DEVICE_FLASH, SPI_DEVICE_CARD or SPI_DEVICE_NONE
+///
+uint8_t hV_HAL_SPI_getOwner();
+
 ///
 /// @brief Combined write and read of a single byte
 /// @param data byte
@@ -213,6 +422,75 @@ void hV_HAL_SPI_end();
 /// @warning No check for previous initialisation
 ///
 uint8_t hV_HAL_SPI_transfer(uint8_t data);
+
+///
+/// @brief Size of the chunks for buffer write
+/// @note Used on platforms where the buffer transfer overwrites the buffer with read data
+///
+#define SPI_CHUNK_LENGTH 64
+
+///
+/// @brief Write a buffer
+/// @param data buffer to write
+/// @param size number of bytes
+/// @note No read-back. Fastest bulk path available on the platform
+/// * ESP32: SPI.writeBytes()
+/// * RP2040 and RP2350: SPI.transfer() with write-only buffer
+/// * Other Arduino cores: SPI.transfer() on chunks of SPI_CHUNK_LENGTH bytes
+/// * Energia: byte per byte, as fallback
+/// @warning No check for previous initialisation
+///
+void hV_HAL_SPI_writeBuffer(const uint8_t * data, uint32_t size);
+
+///
+/// @brief Read a buffer
+/// @param[out] data buffer to fill
+/// @param size number of bytes
+/// @note 0x00 written while reading. Fastest bulk path available on the platform
+/// * Arduino cores: SPI.transfer() in place on the whole buffer
+/// * Energia: byte per byte, as fallback
+/// @warning No check for previous initialisation
+///
+void hV_HAL_SPI_readBuffer(uint8_t * data, uint32_t size);
+
+///
+/// @brief Write the same byte repeatedly
+/// @param data byte to repeat
+/// @param size number of bytes
+/// @note No read-back. Fastest fill path available on the platform
+/// * ESP32: SPI.writePattern()
+/// * RP2040 and RP2350: SPI.transfer() from a pattern buffer of SPI_CHUNK_LENGTH bytes
+/// * Other Arduino cores: SPI.transfer() on chunks of SPI_CHUNK_LENGTH bytes
+/// * Energia: byte per byte, as fallback
+/// @warning No check for previous initialisation
+///
+void hV_HAL_SPI_writeFixed(uint8_t data, uint32_t size);
+
+///
+/// @brief Start an asynchronous write of a buffer
+/// @param data buffer to write
+/// @param size number of bytes
+/// @param callback function called on completion, default = 0 = none
+/// @note Platforms with DMA
+/// * RP2040 and RP2350: SPI.transferAsync(), callback called when completion is detected by hV_HAL_SPI_isAsyncDone() or hV_HAL_SPI_waitAsync()
+/// * Host back-end: completion emulated with the simulated clock
+/// @note Other platforms: synchronous write, callback called before return
+/// @warning Buffer must remain unchanged until completion
+/// @warning No check for previous initialisation
+///
+void hV_HAL_SPI_writeAsync(const uint8_t * data, uint32_t size, void (* callback)(void) = 0);
+
+///
+/// @brief Check completion of the asynchronous write
+/// @return true if completed or none started, false if ongoing
+///
+bool hV_HAL_SPI_isAsyncDone();
+
+///
+/// @brief Wait for completion of the asynchronous write
+/// @note Called by all other SPI functions before using the bus
+///
+void hV_HAL_SPI_waitAsync();
 /// @}
 
 ///
@@ -238,6 +516,7 @@ uint8_t hV_HAL_SPI_transfer(uint8_t data);
 ///
 /// @brief Configure 3-wire SPI
 /// @note Select default SCK as clock and MOSI as data (SDIO)
+/// @note Pin directions configured again at next transfer, call after SPI.begin() or any change of the pins
 ///
 void hV_HAL_SPI3_begin();
 
@@ -257,6 +536,18 @@ void hV_HAL_SPI3_end();
 ///
 void hV_HAL_SPI3_define(uint8_t pinClock = SCK, uint8_t pinData = MOSI);
 
+///
+/// @brief Set the 3-wire SPI frequency
+/// @param frequency target frequency in Hz, default = 500000 = 1 us per half-bit
+/// @note Half-bit wait = 500000 / frequency us, rounded down
+/// * frequency > 500000: no wait, fastest bit-bang
+/// * frequency < 8: wait clamped to 65535 us
+/// @note Write: wait after the data, after the clock high and after the clock low, as before
+/// @note AVR: port writes with interrupts disabled, SAMD: set and clear registers
+/// @note Actual frequency depends on the platform and the GPIO access
+///
+void hV_HAL_SPI3_setFrequency(uint32_t frequency = 500000);
+
 ///
 /// @brief Read a single byte
 /// @return read byte
@@ -273,6 +564,24 @@ uint8_t hV_HAL_SPI3_read();
 ///
 void hV_HAL_SPI3_write(uint8_t value);
 
+///
+/// @brief Read a block of bytes
+/// @param[out] data buffer to read
+/// @param[in] size number of bytes
+/// @note Configure the clock pin as output and data pin as input, once per block.
+/// @warning /CS to be managed externally.
+///
+void hV_HAL_SPI3_readBlock(uint8_t * data, uint32_t size);
+
+///
+/// @brief Write a block of bytes
+/// @param data buffer to write
+/// @param size number of bytes
+/// @note Configure the clock and data pins as output, once per block.
+/// @warning /CS to be managed externally.
+///
+void hV_HAL_SPI3_writeBlock(const uint8_t * data, uint32_t size);
+
 /// @}
 
 ///
@@ -335,6 +644,9 @@ uint8_t hV_HAL_Wire_transfer(uint8_t address, uint8_t * dataWrite, size_t sizeWr
 /// @param level Debug level message
 /// @param format see https://www.cplusplus.com/reference/cstdio/printf/ for tokens
 /// @note With final CR-LF
+/// @note With hV_HAL_LOG_DEFERRED, recorded into the ring buffer and sent by hV_HAL_Log_flush()
+/// @warning With hV_HAL_LOG_DEFERRED, strings %s and pointers %p are not recorded and print as ?
+/// @see hV_HAL_Log_recordList() for the conversions supported in deferred mode
 ///
 void hV_HAL_log(uint16_t level, const char * format, ...);
 
@@ -0,0 +1,465 @@
+//
+// hV_HAL_Trace.cpp
+// Library C++ code
+// ----------------------------------
+//
+// Details Bus trace recorder for the light hardware abstraction layer
+// Project highView Library Suite
+//
+// Created by Rei Vilo, 17 Oct 2026
+//
+// Copyright (c) Etigues, 2010-2025
+// Licence All rights reserved
+// For exclusive use with Pervasive Displays screens
+//
+// * Basic edition: for hobbyists and for basic usage
+// Creative Commons Attribution-ShareAlike 4.0 International (CC BY-SA 4.0)
+//
+// * Evaluation edition: for professionals or organisations, evaluation only, no commercial usage
+// All rights reserved
+//
+// * Commercial edition: for professionals or organisations, commercial usage
+// All rights reserved
+//
+// Release 1000: Initial release
+// Release 1001: Added dump, save and load
+//
+
+// Library header
+#include "hV_HAL_Peripherals.h"
+
+//
+// === Ring buffer section
+//
+#if defined(hV_HAL_TRACE)
+
+///
+/// @brief Ring buffer
+/// @note Single producer, oldest record overwritten when full
+///
+struct h_trace_t
+{
+    traceRecord_t records[TRACE_LENGTH]; ///< ring buffer
+    volatile uint32_t count; ///< number of records since last clear
+};
+
+h_trace_t h_trace = { {}, 0 };
+
+void hV_HAL_Trace_record(uint8_t type, uint8_t id, uint32_t value)
+{
+    uint32_t index = h_trace.count;
+    traceRecord_t * record = &h_trace.records[index % TRACE_LENGTH];
+
+    record->time = micros();
+    record->value = value;
+    record->type = type;
+    record->id = id;
+
+    h_trace.count = index + 1;
+}
+
+uint32_t hV_HAL_Trace_copy(traceRecord_t * records, uint32_t size)
+{
+    uint32_t count = h_trace.count;
+    uint32_t available = hV_HAL_min(count, (uint32_t)TRACE_LENGTH);
+    uint32_t number = hV_HAL_min(available, size);
+    uint32_t first = count - available;
+
+    for (uint32_t index = 0; index < number; index++)
+    {
+        records[index] = h_trace.records[(first + index) % TRACE_LENGTH];
+    }
+    return number;
+}
+
+uint32_t hV_HAL_Trace_getDropped()
+{
+    uint32_t count = h_trace.count;
+    return (count > TRACE_LENGTH) ? (count - TRACE_LENGTH) : 0;
+}
+
+void hV_HAL_Trace_clear()
+{
+    h_trace.count = 0;
+}
+
+#else
+
+uint32_t hV_HAL_Trace_copy(traceRecord_t * records, uint32_t size)
+{
+    (void)records;
+    (void)size;
+    return 0;
+}
+
+uint32_t hV_HAL_Trace_getDropped()
+{
+    return 0;
+}
+
+void hV_HAL_Trace_clear()
+{
+    ;
+}
+
+#endif // hV_HAL_TRACE
+//
+// === End of Ring buffer section
+//
+
+//
+// === Dump section
+//
+///
+/// @brief Output of one line of the dump
+/// @param context FILE * on host, unused otherwise
+/// @param text line without end-of-line
+///
+typedef void (* h_output_t)(void * context, const char * text);
+
+///
+/// @brief Output to the serial console
+///
+static void h_outputSerial(void * context, const char * text)
+{
+    (void)context;
+    hV_HAL_Serial_printf("%s", text);
+    hV_HAL_Serial_crlf();
+}
+
+///
+/// @brief Dump the records, oldest first
+/// @param output line output
+/// @param context passed to output
+/// @return number of records dumped
+///
+static uint32_t h_dump(h_output_t output, void * context)
+{
+    char line[48];
+    uint32_t number = 0;
+    uint32_t dropped = 0;
+
+#if defined(hV_HAL_TRACE)
+
+    uint32_t count = h_trace.count;
+    number = hV_HAL_min(count, (uint32_t)TRACE_LENGTH);
+    dropped = count - number;
+
+#endif // hV_HAL_TRACE
+
+    snprintf(line, sizeof(line), TRACE_DUMP_HEADER, (unsigned int)hV_HAL_TRACE_RELEASE, (unsigned long)number, (unsigned long)dropped);
+    output(context, line);
+
+#if defined(hV_HAL_TRACE)
+
+    for (uint32_t index = 0; index < number; index++)
+    {
+        const traceRecord_t & record = h_trace.records[(dropped + index) % TRACE_LENGTH];
+        snprintf(line, sizeof(line), TRACE_DUMP_RECORD, (unsigned long)record.time, (unsigned long)record.value, record.type, record.id);
+        output(context, line);
+    }
+
+#endif // hV_HAL_TRACE
+
+    output(context, TRACE_DUMP_FOOTER);
+    return number;
+}
+
+uint32_t hV_HAL_Trace_dump()
+{
+    return h_dump(h_outputSerial, 0);
+}
+
+#if defined(hV_HAL_HOST)
+
+///
+/// @brief Output to a file
+///
+static void h_outputFile(void * context, const char * text)
+{
+    fprintf((FILE *)context, "%s\n", text);
+}
+
+uint32_t hV_HAL_Trace_save(FILE * file)
+{
+    return h_dump(h_outputFile, file);
+}
+
+uint32_t hV_HAL_Trace_load(FILE * file, std::vector<traceRecord_t> & records)
+{
+    char line[128];
+    bool flagHeader = false;
+
+    records.clear();
+    while (fgets(line, sizeof(line), file) != 0)
+    {
+        // Console output before the header ignored
+        if (flagHeader == false)
+        {
+            unsigned int release;
+            unsigned long number, dropped;
+            flagHeader = (sscanf(line, TRACE_DUMP_HEADER, &release, &number, &dropped) == 3);
+            continue;
+        }
+
+        if (strncmp(line, TRACE_DUMP_FOOTER, strlen(TRACE_DUMP_FOOTER)) == 0)
+        {
+            break;
+        }
+
+        unsigned long time, value;
+        unsigned int type, id;
+        if (sscanf(line, TRACE_DUMP_RECORD, &time, &value, &type, &id) == 4)
+        {
+            records.push_back({ (uint32_t)time, (uint32_t)value, (uint8_t)type, (uint8_t)id });
+        }
+    }
+
+    return records.size();
+}
+
+#endif // hV_HAL_HOST
+//
+// === End of Dump section
+//
+
+//
+// === Export section
+//
+#if defined(hV_HAL_HOST)
+
+#include <algorithm>
+
+///
+/// @brief Change of a VCD signal
+///
+struct h_change_t
+{
+    uint64_t time; ///< us
+    uint16_t signal; ///< index of the signal
+    uint32_t value; ///< new value
+};
+
+///
+/// @name VCD signals other than GPIOs
+/// @{
+#define VCD_SPI_BYTE 256 ///< spi_byte, 8 bits
+#define VCD_SPI_BLOCK 257 ///< spi_block, 1 bit
+#define VCD_DELAY 258 ///< delay, 1 bit
+#define VCD_WAIT 259 ///< wait, 1 bit
+#define VCD_NUMBER 260 ///< Number of signals
+/// @}
+
+///
+/// @brief Build a VCD identifier
+/// @param signal index of the signal
+/// @param[out] identifier at least 3 characters
+///
+static void h_identifierVCD(uint16_t signal, char * identifier)
+{
+    identifier[0] = '!' + (signal % 90);
+    identifier[1] = '!' + (signal / 90);
+    identifier[2] = 0x00;
+}
+
+void hV_HAL_Trace_exportVCD(FILE * file, const traceRecord_t * records, uint32_t size)
+{
+    std::vector<h_change_t> changes;
+    bool flagUsed[VCD_NUMBER] = {false};
+
+    for (uint32_t index = 0; index < size; index++)
+    {
+        const traceRecord_t & record = records[index];
+
+        switch (record.type)
+        {
+            case TRACE_GPIO_WRITE:
+            case TRACE_GPIO_READ:
+
+                changes.push_back({ record.time, record.id, record.value });
+                flagUsed[record.id] = true;
+                break;
+
+            case TRACE_DELAY:
+
+                changes.push_back({ record.time, VCD_DELAY, 1 });
+                changes.push_back({ (uint64_t)record.time + record.value, VCD_DELAY, 0 });
+                flagUsed[VCD_DELAY] = true;
+                break;
+
+            case TRACE_SPI_BYTE:
+
+                changes.push_back({ record.time, VCD_SPI_BYTE, record.value });
+                flagUsed[VCD_SPI_BYTE] = true;
+                break;
+
+            case TRACE_SPI_BEGIN:
+            case TRACE_SPI_END:
+
+                changes.push_back({ record.time, VCD_SPI_BLOCK, (record.type == TRACE_SPI_BEGIN) ? 1u : 0u });
+                flagUsed[VCD_SPI_BLOCK] = true;
+                break;
+
+            case TRACE_WAIT_BEGIN:
+            case TRACE_WAIT_END:
+
+                changes.push_back({ record.time, VCD_WAIT, (record.type == TRACE_WAIT_BEGIN) ? 1u : 0u });
+                flagUsed[VCD_WAIT] = true;
+                break;
+
+            default:
+
+                break;
+        }
+    }
+
+    std::stable_sort(changes.begin(), changes.end(), [](const h_change_t & a, const h_change_t & b)
+    {
+        return a.time < b.time;
+    });
+
+    // Header
+    char identifier[3];
+    fprintf(file, "$timescale 1us $end\n");
+    fprintf(file, "$scope module hV_HAL $end\n");
+    for (uint16_t signal = 0; signal < VCD_NUMBER; signal++)
+    {
+        if (flagUsed[signal])
+        {
+            h_identifierVCD(signal, identifier);
+            switch (signal)
+            {
+                case VCD_SPI_BYTE:
+
+                    fprintf(file, "$var reg 8 %s spi_byte $end\n", identifier);
+                    break;
+
+                case VCD_SPI_BLOCK:
+
+                    fprintf(file, "$var wire 1 %s spi_block $end\n", identifier);
+                    break;
+
+                case VCD_DELAY:
+
+                    fprintf(file, "$var wire 1 %s delay $end\n", identifier);
+                    break;
+
+                case VCD_WAIT:
+
+                    fprintf(file, "$var wire 1 %s wait $end\n", identifier);
+                    break;
+
+                default:
+
+                    fprintf(file, "$var wire 1 %s gpio_%i $end\n", identifier, signal);
+                    break;
+            }
+        }
+    }
+    fprintf(file, "$upscope $end\n");
+    fprintf(file, "$enddefinitions $end\n");
+
+    // Changes
+    bool flagFirst = true;
+    uint64_t time = 0;
+    for (const h_change_t & change : changes)
+    {
+        if (flagFirst or (change.time != time))
+        {
+            time = change.time;
+            fprintf(file, "#%llu\n", (unsigned long long)time);
+            flagFirst = false;
+        }
+
+        h_identifierVCD(change.signal, identifier);
+        if (change.signal == VCD_SPI_BYTE)
+        {
+            fprintf(file, "b");
+            for (int8_t bit = 7; bit >= 0; bit--)
+            {
+                fprintf(file, "%c", ((change.value >> bit) & 0x01) ? '1' : '0');
+            }
+            fprintf(file, " %s\n", identifier);
+        }
+        else
+        {
+            fprintf(file, "%c%s\n", (change.value != 0) ? '1' : '0', identifier);
+        }
+    }
+}
+
+void hV_HAL_Trace_exportChrome(FILE * file, const traceRecord_t * records, uint32_t size)
+{
+    // Threads: 1 = GPIO, 2 = SPI, 3 = time
+    fprintf(file, "{\"traceEvents\":[\n");
+
+    bool flagFirst = true;
+    for (uint32_t index = 0; index < size; index++)
+    {
+        const traceRecord_t & record = records[index];
+        const char * separator = flagFirst ? "" : ",\n";
+
+        switch (record.type)
+        {
+            case TRACE_GPIO_WRITE:
+
+                fprintf(file, "%s{\"name\":\"GPIO %i\",\"ph\":\"C\",\"ts\":%u,\"pid\":1,\"tid\":1,\"args\":{\"level\":%u}}",
+                        separator, record.id, record.time, record.value);
+                break;
+
+            case TRACE_GPIO_READ:
+
+                fprintf(file, "%s{\"name\":\"Read GPIO %i\",\"ph\":\"i\",\"s\":\"t\",\"ts\":%u,\"pid\":1,\"tid\":1,\"args\":{\"level\":%u}}",
+                        separator, record.id, record.time, record.value);
+                break;
+
+            case TRACE_DELAY:
+
+                fprintf(file, "%s{\"name\":\"Delay\",\"ph\":\"X\",\"ts\":%u,\"dur\":%u,\"pid\":1,\"tid\":3}",
+                        separator, record.time, record.value);
+                break;
+
+            case TRACE_SPI_BYTE:
+
+                fprintf(file, "%s{\"name\":\"SPI byte\",\"ph\":\"i\",\"s\":\"t\",\"ts\":%u,\"pid\":1,\"tid\":2,\"args\":{\"value\":%u}}",
+                        separator, record.time, record.value);
+                break;
+
+            case TRACE_SPI_BEGIN:
+
+                fprintf(file, "%s{\"name\":\"SPI block\",\"ph\":\"B\",\"ts\":%u,\"pid\":1,\"tid\":2,\"args\":{\"size\":%u}}",
+                        separator, record.time, record.value);
+                break;
+
+            case TRACE_SPI_END:
+
+                fprintf(file, "%s{\"name\":\"SPI block\",\"ph\":\"E\",\"ts\":%u,\"pid\":1,\"tid\":2}",
+                        separator, record.time);
+                break;
+
+            case TRACE_WAIT_BEGIN:
+
+                fprintf(file, "%s{\"name\":\"Wait GPIO %i\",\"ph\":\"B\",\"ts\":%u,\"pid\":1,\"tid\":3,\"args\":{\"state\":%u}}",
+                        separator, record.id, record.time, record.value);
+                break;
+
+            case TRACE_WAIT_END:
+
+                fprintf(file, "%s{\"name\":\"Wait GPIO %i\",\"ph\":\"E\",\"ts\":%u,\"pid\":1,\"tid\":3}",
+                        separator, record.id, record.time);
+                break;
+
+            default:
+
+                continue;
+        }
+        flagFirst = false;
+    }
+
+    fprintf(file, "\n]}\n");
+}
+
+#endif // hV_HAL_HOST
+//
+// === End of Export section
+//
@@ -0,0 +1,202 @@
+///
+/// @file hV_HAL_Trace.h
+/// @brief Bus trace recorder for the light hardware abstraction layer
+///
+/// @details Based on highView technology
+/// @n Records GPIO, SPI, delay and wait events into a fixed-size ring buffer
+/// * Target: recording enabled by defining hV_HAL_TRACE, otherwise compiled out
+/// * Target: dump to the serial console as text
+/// * Host back-end: load a dump, export to VCD and Chrome trace JSON
+///
+/// @date 17 Oct 2026
+/// @version 1001
+///
+/// @copyright (c) Pervasive Displays Inc., 2021-2025
+/// @copyright (c) Etigues, 2010-2025
+/// @copyright All rights reserved
+/// @copyright For exclusive use with Pervasive Displays screens
+///
+/// * Basic edition: for hobbyists and for basic usage
+/// @n Creative Commons Attribution-ShareAlike 4.0 International (CC BY-SA 4.0)
+/// @see https://creativecommons.org/licenses/by-sa/4.0/
+///
+/// @n Consider the Evaluation or Commercial editions for professionals or organisations and for commercial usage
+///
+/// * Evaluation edition: for professionals or organisations, evaluation only, no commercial usage
+/// @n All rights reserved
+///
+/// * Commercial edition: for professionals or organisations, commercial usage
+/// @n All rights reserved
+///
+/// * Viewer edition: for professionals or organisations
+/// @n All rights reserved
+///
+/// * Documentation
+/// @n All rights reserved
+///
+
+#ifndef hV_HAL_TRACE_RELEASE
+///
+/// @brief Release
+///
+#define hV_HAL_TRACE_RELEASE 1001
+
+///
+/// @brief Other libraries
+///
+#include <stdint.h>
+#include <stdio.h>
+
+#if defined(hV_HAL_HOST)
+#include <vector>
+#endif // hV_HAL_HOST
+
+///
+/// @brief Option to record the trace
+/// @note Define hV_HAL_TRACE before including the library, or on the command line
+/// @note Without hV_HAL_TRACE, hV_HAL_TRACE_RECORD() expands to nothing
+///
+// #define hV_HAL_TRACE
+
+///
+/// @brief Number of records in the ring buffer
+/// @note 12 bytes per record
+///
+#ifndef TRACE_LENGTH
+#define TRACE_LENGTH 512
+#endif // TRACE_LENGTH
+
+///
+/// @name Types of trace records
+/// @note Numbers are sequential and exclusive
+/// @{
+#define TRACE_GPIO_WRITE 0x01 ///< id = pin, value = level
+#define TRACE_GPIO_READ 0x02 ///< id = pin, value = level
+#define TRACE_DELAY 0x03 ///< value = duration in us
+#define TRACE_SPI_BYTE 0x04 ///< value = byte
+#define TRACE_SPI_BEGIN 0x05 ///< start of block, value = number of bytes
+#define TRACE_SPI_END 0x06 ///< end of block
+#define TRACE_WAIT_BEGIN 0x07 ///< start of wait, id = pin, value = state
+#define TRACE_WAIT_END 0x08 ///< end of wait, id = pin
+/// @}
+
+///
+/// @brief Trace record
+/// @note Fixed binary layout, suitable for transfer from target to host
+///
+struct traceRecord_t
+{
+    uint32_t time; ///< time stamp, us
+    uint32_t value; ///< level, byte, size or duration
+    uint8_t type; ///< TRACE_GPIO_WRITE to TRACE_WAIT_END
+    uint8_t id; ///< pin, 0 otherwise
+};
+
+#if defined(hV_HAL_TRACE)
+
+///
+/// @brief Record an event
+/// @param type TRACE_GPIO_WRITE to TRACE_WAIT_END
+/// @param id pin, 0 otherwise
+/// @param value level, byte, size or duration
+/// @note Oldest record overwritten when the ring buffer is full
+///
+void hV_HAL_Trace_record(uint8_t type, uint8_t id, uint32_t value);
+
+///
+/// @brief Record macro
+///
+#define hV_HAL_TRACE_RECORD(T, I, V) hV_HAL_Trace_record(T, I, V)
+
+#else
+
+///
+/// @brief Record macro, compiled out
+///
+#define hV_HAL_TRACE_RECORD(T, I, V)
+
+#endif // hV_HAL_TRACE
+
+///
+/// @brief Copy the records, oldest first
+/// @param[out] records buffer
+/// @param[in] size maximum number of records
+/// @return number of records copied
+/// @note Returns 0 without hV_HAL_TRACE
+///
+uint32_t hV_HAL_Trace_copy(traceRecord_t * records, uint32_t size);
+
+///
+/// @brief Get the number of records overwritten
+/// @return number of records lost since last clear
+///
+uint32_t hV_HAL_Trace_getDropped();
+
+///
+/// @brief Clear the ring buffer
+///
+void hV_HAL_Trace_clear();
+
+///
+/// @name Dump format
+/// @brief Text, one line per record, suitable for capture from the serial console
+/// * Header: release, number of records, number of records dropped
+/// * Record: time, value, type and id, in hexadecimal
+/// * Footer
+/// @{
+#define TRACE_DUMP_HEADER "hV trace %u %lu %lu" ///< release, number, dropped
+#define TRACE_DUMP_RECORD "%08lx %08lx %02x %02x" ///< time, value, type, id
+#define TRACE_DUMP_FOOTER "hV trace end"
+/// @}
+
+///
+/// @brief Dump the records to the serial console, oldest first
+/// @return number of records dumped
+/// @note Header and footer only without hV_HAL_TRACE
+/// @see extras/trace/trace_convert.cpp for conversion to VCD and Chrome trace JSON
+///
+uint32_t hV_HAL_Trace_dump();
+
+#if defined(hV_HAL_HOST)
+
+///
+/// @brief Save the records to a file, oldest first
+/// @param file output file
+/// @return number of records saved
+/// @note Same format as hV_HAL_Trace_dump()
+/// @note Host back-end only
+///
+uint32_t hV_HAL_Trace_save(FILE * file);
+
+///
+/// @brief Load records from a dump
+/// @param file dump, lines before the header ignored
+/// @param[out] records records, oldest first
+/// @return number of records loaded
+/// @note Host back-end only
+///
+uint32_t hV_HAL_Trace_load(FILE * file, std::vector<traceRecord_t> & records);
+
+///
+/// @brief Export records as VCD
+/// @param file output file
+/// @param records records, oldest first
+/// @param size number of records
+/// @note Signals: one per GPIO, spi byte, spi block, delay and wait
+/// @note Host back-end only
+///
+void hV_HAL_Trace_exportVCD(FILE * file, const traceRecord_t * records, uint32_t size);
+
+///
+/// @brief Export records as Chrome trace JSON
+/// @param file output file
+/// @param records records, oldest first
+/// @param size number of records
+/// @note Open with chrome://tracing or https://ui.perfetto.dev
+/// @note Host back-end only
+///
+void hV_HAL_Trace_exportChrome(FILE * file, const traceRecord_t * records, uint32_t size);
+
+#endif // hV_HAL_HOST
+
+#endif // hV_HAL_TRACE_RELEASE
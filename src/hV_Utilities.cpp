@@ -34,6 +34,8 @@
 // Release 1000: Added support for 16-bit fonts
 // Release 1000: Added UTF-16 characters traceability
 // Release 1001: Improved 16-bit font generation
+// Release 1001: Added word-wide frame comparison
+// Release 1001: Fixed limit of UTF-8 to UTF-16 conversion
 //
 
 // Library header
@@ -128,7 +130,8 @@ uint16_t utf8to16(STRING_CONST_TYPE inUTF8, STRING16_BYREF_TYPE outUTF16, uint8_
         }
         ++_work8;
 
-        if (((*_work8 & 0xc0) != 0x80) and (char16 <= 0xffff))
+        // Sequence complete
+        if ((*_work8 & 0xc0) != 0x80)
         {
             // Checks specific to Basic edition
             if (char16 == 0x20ac)
@@ -140,6 +143,11 @@ uint16_t utf8to16(STRING_CONST_TYPE inUTF8, STRING16_BYREF_TYPE outUTF16, uint8_
                 char16 = 0xb7; // Code for non-supported characters
             }
             outUTF16[i16++] = char16;
+
+            if ((limit > 0) and (i16 >= limit))
+            {
+                flag = false;
+            }
         }
     }
     outUTF16[i16] = 0x0000; // Null-terminate the output array
@@ -203,3 +211,71 @@ uint16_t GridXY::y(uint16_t i)
 {
     return (_y0 + i * _dy);
 }
+
+///
+/// @brief Word for frame comparison
+/// @note Native register width
+///
+#if (UINTPTR_MAX > 0xffffffff)
+typedef uint64_t h_word_t;
+#else
+typedef uint32_t h_word_t;
+#endif // UINTPTR_MAX
+
+uint32_t diffFrames(const uint8_t * frame1, const uint8_t * frame2, uint32_t size, uint16_t stride, frameDiff_t & diff)
+{
+    diff = { 0, 0xffffffff, 0, 0xffffffff, 0 };
+    uint32_t length = (stride > 0) ? stride : size;
+    uint32_t row = 0; // Up to size rows with stride = 1
+
+    for (uint32_t start = 0; start < size; start += length, row++)
+    {
+        uint32_t end = hV_HAL_min(start + length, size);
+        uint32_t index = start;
+        uint32_t count = 0;
+        uint32_t first = end;
+        uint32_t last = 0;
+
+        while (index < end)
+        {
+            // Word-wide, bytes only for the changed words
+            if (index + sizeof(h_word_t) <= end)
+            {
+                h_word_t word1, word2;
+                memcpy(&word1, frame1 + index, sizeof(h_word_t)); // Unaligned access
+                memcpy(&word2, frame2 + index, sizeof(h_word_t));
+                if (word1 == word2)
+                {
+                    index += sizeof(h_word_t);
+                    continue;
+                }
+            }
+
+            uint32_t limit = hV_HAL_min(index + (uint32_t)sizeof(h_word_t), end);
+            for (; index < limit; index++)
+            {
+                if (frame1[index] != frame2[index])
+                {
+                    count++;
+                    first = hV_HAL_min(first, index);
+                    last = index;
+                }
+            }
+        }
+
+        if (count > 0)
+        {
+            diff.count += count;
+            diff.rowFirst = hV_HAL_min(diff.rowFirst, row);
+            diff.rowLast = row;
+            diff.columnFirst = hV_HAL_min(diff.columnFirst, first - start);
+            diff.columnLast = hV_HAL_max(diff.columnLast, last - start);
+        }
+    }
+
+    if (diff.count == 0)
+    {
+        diff = { 0, 0, 0, 0, 0 };
+    }
+    return diff.count;
+}
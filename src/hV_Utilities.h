@@ -231,6 +231,40 @@ class GridXY
     uint16_t _dx, _dy; ///< size of the division
 };
 
+/// @}
+
+///
+/// @name Frame functions
+/// @brief Comparison of frame planes
+///
+/// @{
+
+///
+/// @brief Differences between two frame planes
+/// @note Rows and columns of bytes, columns in pixels = 8 * columns in bytes
+///
+struct frameDiff_t
+{
+    uint32_t count; ///< number of bytes changed, 0 = identical
+    uint32_t rowFirst; ///< first row changed
+    uint32_t rowLast; ///< last row changed
+    uint32_t columnFirst; ///< first column changed, bytes
+    uint32_t columnLast; ///< last column changed, bytes
+};
+
+///
+/// @brief Compare two frame planes
+/// @param[in] frame1 first frame plane
+/// @param[in] frame2 second frame plane
+/// @param[in] size number of bytes per frame plane
+/// @param[in] stride number of bytes per row, 0 = whole frame as one row, columns up to size - 1
+/// @param[out] diff number of bytes changed, row range and bounding box
+/// @return number of bytes changed, 0 = identical
+/// @note Word-wide comparison, 64 bits on 64-bit platforms and 32 bits otherwise,
+/// bytes examined only in the words changed
+///
+uint32_t diffFrames(const uint8_t * frame1, const uint8_t * frame2, uint32_t size, uint16_t stride, frameDiff_t & diff);
+
 //
 // --- Advanced edition
 //